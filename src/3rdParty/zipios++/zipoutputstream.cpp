@@ -64,6 +64,16 @@ void ZipOutputStream::putNextEntry(const std::string& entryName) {
 }
 
 
+void ZipOutputStream::putCompressedEntry( const ZipCDirEntry &entry, const char *data, uint32 size ) {
+  ozf->putCompressedEntry( entry, data, size ) ;
+}
+
+
+int ZipOutputStream::getLevel() const {
+  return ozf->getLevel() ;
+}
+
+
 void ZipOutputStream::setComment( const std::string &comment ) {
   ozf->setComment( comment ) ;
 }
@@ -57,6 +57,14 @@ public:
   /** Sets the global comment for the Zip archive. */
   void setComment( const std::string& comment ) ;
 
+  /** Writes an entry whose data has already been compressed.
+      The method, the crc and the uncompressed size must be set in
+      entry, data must hold the compressed data of the entry. */
+  void putCompressedEntry( const ZipCDirEntry &entry, const char *data, uint32 size ) ;
+
+  /** Returns the compression level used for subsequent entries. */
+  int getLevel() const ;
+
   /** Sets the compression level to be used for subsequent entries. */
   void setLevel( int level ) ;
 
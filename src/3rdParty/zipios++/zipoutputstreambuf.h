@@ -49,6 +49,15 @@ public:
       entry. */
   void putNextEntry( const ZipCDirEntry &entry ) ;
 
+  /** Writes an entry whose data has already been compressed.
+      The method, the crc and the uncompressed size must be set in
+      entry, data must hold the compressed data of the entry. The
+      current entry is closed first and no entry is open afterwards. */
+  void putCompressedEntry( const ZipCDirEntry &entry, const char *data, uint32 size ) ;
+
+  /** Returns the compression level used for subsequent entries. */
+  int getLevel() const ;
+
   /** Sets the global comment for the Zip archive. */
   void setComment( const string &comment ) ;
 
@@ -68,6 +77,7 @@ protected:
 
   void setEntryClosedState() ;
   void updateEntryHeaderInfo() ;
+  static int currentDosTime() ;
 
   // Should/could be moved to zipheadio.h ?!
   static void writeCentralDirectory( const vector< ZipCDirEntry > &entries, 
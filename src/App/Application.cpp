@@ -824,6 +824,15 @@ bool Application::isFineGrainedRecomputeEnabled()
     return enableFineGrainedRecompute;
 }
 
+bool Application::isParallelRecomputeEnabled()
+{
+    static const ParameterGrp::handle hGrp = GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Document"
+    );
+    bool enableParallelRecompute = hGrp->GetBool("EnableParallelRecompute", false);
+    return enableParallelRecompute;
+}
+
 bool Application::canRecomputeRequestOnWorker(const RecomputeRequest& req) const
 {
     if (DocumentObject* documentObject = req.resolveDocumentObject()) {
@@ -2315,6 +2324,7 @@ void Application::initTypes()
     App::FeatureTestPlacement      ::init();
     App::FeatureTestAttribute      ::init();
     App::FeatureTestAsyncBlocker   ::init();
+    App::FeatureTestConcurrent     ::init();
 
     // Feature class
     App::FeaturePython             ::init();
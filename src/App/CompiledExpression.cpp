@@ -0,0 +1,587 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/****************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL               *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <Base/Exception.h>
+
+#include "CompiledExpression.h"
+#include "ExpressionParser.h"
+#include "PropertyStandard.h"
+#include "PropertyUnits.h"
+
+
+using namespace App;
+
+namespace
+{
+
+using Value = CompiledExpression::Value;
+using Kind = CompiledExpression::Value::Kind;
+
+// Python integers are exact and unbounded. Only keep integers as such as long
+// as doubles and the 'long' of App::any represent them exactly.
+bool isExactInteger(double value)
+{
+    constexpr double maxExact = 9007199254740992.0;  // 2^53
+    return std::fabs(value) <= maxExact
+        && std::fabs(value) <= static_cast<double>(std::numeric_limits<long>::max());
+}
+
+Value makeNumber(double value, Kind kind)
+{
+    return {Base::Quantity(value), kind};
+}
+
+// Mirrors pyFromQuantity() used for number literals
+bool fromConstant(const Base::Quantity& quantity, Value& res)
+{
+    if (!quantity.isDimensionless()) {
+        res = {quantity, Kind::Quantity};
+        return true;
+    }
+    double value = quantity.getValue();
+    double intpart {};
+    if (std::modf(value, &intpart) != 0.0) {
+        res = makeNumber(value, Kind::Float);
+        return true;
+    }
+    if (intpart < std::numeric_limits<int>::min() || intpart > std::numeric_limits<int>::max()) {
+        return false;
+    }
+    res = makeNumber(intpart, Kind::Integer);
+    return true;
+}
+
+// Mirrors the Python objects returned by the supported property types
+bool fromProperty(const Property* prop, Value& res)
+{
+    if (auto quantity = freecad_cast<PropertyQuantity*>(prop)) {
+        res = {Base::Quantity(quantity->getValue(), quantity->getUnit()), Kind::Quantity};
+        return true;
+    }
+    if (auto number = freecad_cast<PropertyFloat*>(prop)) {
+        res = makeNumber(number->getValue(), Kind::Float);
+        return true;
+    }
+    if (auto integer = freecad_cast<PropertyInteger*>(prop)) {
+        auto value = static_cast<double>(integer->getValue());
+        if (!isExactInteger(value)) {
+            return false;
+        }
+        res = makeNumber(value, Kind::Integer);
+        return true;
+    }
+    if (auto boolean = freecad_cast<PropertyBool*>(prop)) {
+        res = makeNumber(boolean->getValue() ? 1.0 : 0.0, Kind::Boolean);
+        return true;
+    }
+    return false;
+}
+
+bool isTrue(const Value& value)
+{
+    return value.quantity.getValue() != 0.0;
+}
+
+// Python's floored modulo of floats
+double floatModulo(double a, double b)
+{
+    double mod = std::fmod(a, b);
+    if (mod != 0.0) {
+        if ((b < 0) != (mod < 0)) {
+            mod += b;
+        }
+    }
+    else {
+        mod = std::copysign(0.0, b);
+    }
+    return mod;
+}
+
+bool unary(int op, const Value& arg, Value& res)
+{
+    switch (op) {
+        case OperatorExpression::POS:
+            res = arg;
+            if (res.kind == Kind::Boolean) {
+                res.kind = Kind::Integer;
+            }
+            return true;
+        case OperatorExpression::NEG:
+            if (arg.kind == Kind::Quantity) {
+                res = {arg.quantity * -1.0, Kind::Quantity};
+            }
+            else {
+                res = makeNumber(-arg.quantity.getValue(),
+                                 arg.kind == Kind::Float ? Kind::Float : Kind::Integer);
+            }
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool compare(int op, const Value& left, const Value& right, Value& res)
+{
+    bool result {};
+    if (left.kind == Kind::Quantity && right.kind == Kind::Quantity) {
+        // Same as QuantityPy::richCompare()
+        const auto& u1 = left.quantity;
+        const auto& u2 = right.quantity;
+        switch (op) {
+            case OperatorExpression::EQ:
+                result = u1 == u2;
+                break;
+            case OperatorExpression::NEQ:
+                result = !(u1 == u2);
+                break;
+            case OperatorExpression::LT:
+                result = u1 < u2;
+                break;
+            case OperatorExpression::LTE:
+                result = (u1 < u2) || (u1 == u2);
+                break;
+            case OperatorExpression::GT:
+                result = !(u1 < u2) && !(u1 == u2);
+                break;
+            case OperatorExpression::GTE:
+                result = !(u1 < u2);
+                break;
+            default:
+                return false;
+        }
+    }
+    else if (left.kind != Kind::Quantity && right.kind != Kind::Quantity) {
+        double a = left.quantity.getValue();
+        double b = right.quantity.getValue();
+        switch (op) {
+            case OperatorExpression::EQ:
+                result = a == b;
+                break;
+            case OperatorExpression::NEQ:
+                result = a != b;
+                break;
+            case OperatorExpression::LT:
+                result = a < b;
+                break;
+            case OperatorExpression::LTE:
+                result = a <= b;
+                break;
+            case OperatorExpression::GT:
+                result = a > b;
+                break;
+            case OperatorExpression::GTE:
+                result = a >= b;
+                break;
+            default:
+                return false;
+        }
+    }
+    else {
+        return false;
+    }
+    res = makeNumber(result ? 1.0 : 0.0, Kind::Boolean);
+    return true;
+}
+
+bool binary(int op, const Value& left, const Value& right, Value& res)
+{
+    switch (op) {
+        case OperatorExpression::EQ:
+        case OperatorExpression::NEQ:
+        case OperatorExpression::LT:
+        case OperatorExpression::LTE:
+        case OperatorExpression::GT:
+        case OperatorExpression::GTE:
+            return compare(op, left, right, res);
+        default:
+            break;
+    }
+
+    double a = left.quantity.getValue();
+    double b = right.quantity.getValue();
+    bool quantity = left.kind == Kind::Quantity || right.kind == Kind::Quantity;
+    // Python booleans are integers in arithmetic
+    bool integer = (left.kind == Kind::Integer || left.kind == Kind::Boolean)
+        && (right.kind == Kind::Integer || right.kind == Kind::Boolean);
+
+    switch (op) {
+        case OperatorExpression::ADD:
+        case OperatorExpression::SUB:
+        case OperatorExpression::MUL:
+        case OperatorExpression::UNIT: {
+            if (quantity) {
+                // Same as the QuantityPy number handlers, which also throw on unit mismatch
+                if (op == OperatorExpression::ADD) {
+                    res = {left.quantity + right.quantity, Kind::Quantity};
+                }
+                else if (op == OperatorExpression::SUB) {
+                    res = {left.quantity - right.quantity, Kind::Quantity};
+                }
+                else {
+                    res = {left.quantity * right.quantity, Kind::Quantity};
+                }
+                return true;
+            }
+            double value = op == OperatorExpression::ADD ? a + b
+                : op == OperatorExpression::SUB          ? a - b
+                                                         : a * b;
+            if (integer && !isExactInteger(value)) {
+                return false;
+            }
+            res = makeNumber(value, integer ? Kind::Integer : Kind::Float);
+            return true;
+        }
+        case OperatorExpression::DIV:
+            if (quantity) {
+                res = {left.quantity / right.quantity, Kind::Quantity};
+                return true;
+            }
+            if (b == 0.0) {
+                return false;  // ZeroDivisionError
+            }
+            res = makeNumber(a / b, Kind::Float);
+            return true;
+        case OperatorExpression::MOD:
+            if (right.kind == Kind::Quantity && left.kind != Kind::Quantity) {
+                return false;  // TypeError
+            }
+            if (b == 0.0) {
+                return false;  // ZeroDivisionError
+            }
+            if (left.kind == Kind::Quantity) {
+                res = {Base::Quantity(floatModulo(a, b), left.quantity.getUnit()), Kind::Quantity};
+            }
+            else {
+                // Python's integer modulo is floored as well and exact in this range
+                res = makeNumber(floatModulo(a, b), integer ? Kind::Integer : Kind::Float);
+            }
+            return true;
+        case OperatorExpression::POW: {
+            if (left.kind == Kind::Quantity) {
+                if (right.kind == Kind::Quantity) {
+                    res = {left.quantity.pow(right.quantity), Kind::Quantity};
+                }
+                else {
+                    res = {left.quantity.pow(b), Kind::Quantity};
+                }
+                return true;
+            }
+            if (right.kind == Kind::Quantity) {
+                return false;  // TypeError
+            }
+            if ((a == 0.0 && b < 0.0) || (a < 0.0 && std::trunc(b) != b)) {
+                return false;  // ZeroDivisionError or complex result
+            }
+            double value = std::pow(a, b);
+            if (!std::isfinite(value) && std::isfinite(a) && std::isfinite(b)) {
+                return false;  // OverflowError
+            }
+            bool integerResult = integer && b >= 0.0;
+            if (integerResult && !isExactInteger(value)) {
+                return false;
+            }
+            res = makeNumber(value, integerResult ? Kind::Integer : Kind::Float);
+            return true;
+        }
+        default:
+            return false;
+    }
+}
+
+bool isScalarFunction(int f)
+{
+    switch (f) {
+        case FunctionExpression::ABS:
+        case FunctionExpression::ACOS:
+        case FunctionExpression::ASIN:
+        case FunctionExpression::ATAN:
+        case FunctionExpression::ATAN2:
+        case FunctionExpression::CATH:
+        case FunctionExpression::CBRT:
+        case FunctionExpression::CEIL:
+        case FunctionExpression::COS:
+        case FunctionExpression::COSH:
+        case FunctionExpression::EXP:
+        case FunctionExpression::FLOOR:
+        case FunctionExpression::HYPOT:
+        case FunctionExpression::LOG:
+        case FunctionExpression::LOG10:
+        case FunctionExpression::MOD:
+        case FunctionExpression::POW:
+        case FunctionExpression::ROUND:
+        case FunctionExpression::SIN:
+        case FunctionExpression::SINH:
+        case FunctionExpression::SQRT:
+        case FunctionExpression::TAN:
+        case FunctionExpression::TANH:
+        case FunctionExpression::TRUNC:
+        case FunctionExpression::NOT:
+            return true;
+        default:
+            return false;
+    }
+}
+
+}  // namespace
+
+std::shared_ptr<CompiledExpression>
+CompiledExpression::compile(std::shared_ptr<const Expression> expr)
+{
+    auto res = std::make_shared<CompiledExpression>();
+    if (!expr) {
+        return res;
+    }
+    std::size_t depth = 0;
+    res->expression = std::move(expr);
+    if (!res->compileNode(res->expression.get(), depth)) {
+        res->program.clear();
+    }
+    return res;
+}
+
+bool CompiledExpression::compileNode(const Expression* expr, std::size_t& depth)
+{
+    if (!expr || expr->hasComponent()) {
+        return false;
+    }
+
+    std::size_t start = program.size();
+    auto push = [&](Instruction&& instruction, std::ptrdiff_t change) {
+        program.push_back(std::move(instruction));
+        depth = static_cast<std::size_t>(static_cast<std::ptrdiff_t>(depth) + change);
+        stackSize = std::max(stackSize, depth);
+    };
+
+    Base::Type type = expr->getTypeId();
+    if (type == NumberExpression::getClassTypeId() || type == UnitExpression::getClassTypeId()
+        || type == ConstantExpression::getClassTypeId()) {
+        Value value;
+        if (auto constant = freecad_cast<ConstantExpression*>(expr); constant && !constant->isNumber()) {
+            std::string name = constant->getName();
+            if (name != "True" && name != "False") {
+                return false;
+            }
+            value = makeNumber(name == "True" ? 1.0 : 0.0, Kind::Boolean);
+        }
+        else if (!fromConstant(static_cast<const UnitExpression*>(expr)->getQuantity(), value)) {
+            return false;
+        }
+        push({OpCode::Push, 0, 0, 0, value}, 1);
+        return true;
+    }
+
+    if (type == VariableExpression::getClassTypeId()) {
+        Instruction instruction {OpCode::Load};
+        instruction.variable = static_cast<const VariableExpression*>(expr);
+        push(std::move(instruction), 1);
+        return true;
+    }
+
+    if (type == OperatorExpression::getClassTypeId()) {
+        auto operation = static_cast<const OperatorExpression*>(expr);
+        int op = operation->getOperator();
+        if (!compileNode(operation->getLeft(), depth)) {
+            return false;
+        }
+        if (op == OperatorExpression::NEG || op == OperatorExpression::POS) {
+            push({OpCode::Unary, op}, 0);
+        }
+        else {
+            if (!compileNode(operation->getRight(), depth)) {
+                return false;
+            }
+            push({OpCode::Binary, op}, -1);
+        }
+        foldConstants(start);
+        return true;
+    }
+
+    if (type == FunctionExpression::getClassTypeId()) {
+        auto function = static_cast<const FunctionExpression*>(expr);
+        const auto& args = function->getArgs();
+        if (!isScalarFunction(function->getFunction()) || args.empty() || args.size() > 3) {
+            return false;
+        }
+        for (auto arg : args) {
+            if (!compileNode(arg, depth)) {
+                return false;
+            }
+        }
+        push({OpCode::Function, function->getFunction(), args.size()},
+             1 - static_cast<std::ptrdiff_t>(args.size()));
+        foldConstants(start);
+        return true;
+    }
+
+    if (type == ConditionalExpression::getClassTypeId()) {
+        auto conditional = static_cast<const ConditionalExpression*>(expr);
+        if (!compileNode(conditional->getCondition(), depth)) {
+            return false;
+        }
+        std::size_t jumpIfFalse = program.size();
+        push({OpCode::JumpIfFalse}, -1);
+        if (!compileNode(conditional->getTrueExpression(), depth)) {
+            return false;
+        }
+        std::size_t jump = program.size();
+        push({OpCode::Jump}, -1);
+        program[jumpIfFalse].target = program.size();
+        if (!compileNode(conditional->getFalseExpression(), depth)) {
+            return false;
+        }
+        program[jump].target = program.size();
+        foldConstants(start);
+        return true;
+    }
+
+    return false;
+}
+
+void CompiledExpression::foldConstants(std::size_t start)
+{
+    if (program.size() - start < 2) {
+        return;
+    }
+    for (std::size_t i = start; i < program.size(); ++i) {
+        if (program[i].code == OpCode::Load) {
+            return;
+        }
+    }
+
+    // Evaluating may fail, e.g. on a unit mismatch. Keep the code then, so
+    // that the error is reported by the regular evaluation.
+    std::vector<Value> stack;
+    stack.reserve(stackSize);
+    if (!run(start, program.size(), stack) || stack.size() != 1) {
+        return;
+    }
+    program.resize(start);
+    program.push_back({OpCode::Push, 0, 0, 0, stack.back()});
+}
+
+bool CompiledExpression::run(std::size_t start, std::size_t end, std::vector<Value>& stack) const
+{
+    try {
+        for (std::size_t pc = start; pc < end;) {
+            const Instruction& instruction = program[pc++];
+            switch (instruction.code) {
+                case OpCode::Push:
+                    stack.push_back(instruction.constant);
+                    break;
+                case OpCode::Load: {
+                    Value value;
+                    if (!fromProperty(instruction.variable->getWholeProperty(), value)) {
+                        return false;
+                    }
+                    stack.push_back(value);
+                    break;
+                }
+                case OpCode::Unary:
+                    if (!unary(instruction.op, stack.back(), stack.back())) {
+                        return false;
+                    }
+                    break;
+                case OpCode::Binary: {
+                    Value right = stack.back();
+                    stack.pop_back();
+                    if (!binary(instruction.op, stack.back(), right, stack.back())) {
+                        return false;
+                    }
+                    break;
+                }
+                case OpCode::Function: {
+                    std::size_t base = stack.size() - instruction.count;
+                    Base::Quantity args[3];
+                    for (std::size_t i = 0; i < instruction.count; ++i) {
+                        args[i] = stack[base + i].quantity;
+                    }
+                    auto value = FunctionExpression::evaluateScalar(expression.get(),
+                                                                    instruction.op,
+                                                                    instruction.count,
+                                                                    args[0],
+                                                                    args[1],
+                                                                    args[2]);
+                    stack.resize(base);
+                    stack.push_back({value, Kind::Quantity});
+                    break;
+                }
+                case OpCode::Jump:
+                    pc = instruction.target;
+                    break;
+                case OpCode::JumpIfFalse: {
+                    bool condition = isTrue(stack.back());
+                    stack.pop_back();
+                    if (!condition) {
+                        pc = instruction.target;
+                    }
+                    break;
+                }
+            }
+        }
+    }
+    catch (const Base::Exception&) {
+        return false;
+    }
+    return true;
+}
+
+bool CompiledExpression::evaluate(Value& value) const
+{
+    if (program.empty()) {
+        return false;
+    }
+
+    std::vector<Value> stack;
+    stack.reserve(stackSize);
+    if (!run(0, program.size(), stack) || stack.size() != 1) {
+        return false;
+    }
+    value = stack.back();
+    return true;
+}
+
+bool CompiledExpression::evaluate(App::any& value) const
+{
+    Value result;
+    if (!evaluate(result)) {
+        return false;
+    }
+
+    switch (result.kind) {
+        case Kind::Boolean:
+        case Kind::Integer:
+            value = static_cast<long>(result.quantity.getValue());
+            break;
+        case Kind::Float:
+            value = result.quantity.getValue();
+            break;
+        case Kind::Quantity:
+            value = result.quantity;
+            break;
+    }
+    return true;
+}
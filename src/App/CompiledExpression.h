@@ -0,0 +1,147 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/****************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL               *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <Base/Quantity.h>
+
+#include "Expression.h"
+
+namespace App
+{
+
+class VariableExpression;
+
+/**
+ * @brief A flattened form of a numeric expression that evaluates without Python.
+ * @ingroup ExpressionFramework
+ *
+ * @details Expression trees made of numbers, numeric constants, arithmetic
+ * and comparison operators, conditionals, the scalar math functions and
+ * references to integer, float, boolean and quantity properties are compiled
+ * into a postfix program that works on Base::Quantity values.  Constant
+ * sub-expressions, including their unit checks, are folded when compiling.
+ *
+ * The program reproduces the values that Expression::getValueAsAny() would
+ * return.  Whenever it cannot do so, e.g. for an unsupported expression, a
+ * property of another type, or an operation that would raise a Python
+ * exception, evaluate() fails and the caller falls back to the regular
+ * evaluation, which also takes care of reporting errors.
+ */
+class AppExport CompiledExpression
+{
+public:
+    /**
+     * @brief Compile an expression.
+     *
+     * @param[in] expr The expression to compile.
+     *
+     * @return The compiled expression.  It keeps a reference to @p expr and
+     * is not valid if @p expr cannot be compiled.
+     */
+    static std::shared_ptr<CompiledExpression> compile(std::shared_ptr<const Expression> expr);
+
+    /// The expression this program was compiled from.
+    const std::shared_ptr<const Expression>& getExpression() const
+    {
+        return expression;
+    }
+
+    /// Check whether the expression could be compiled.
+    bool isValid() const
+    {
+        return !program.empty();
+    }
+
+    /**
+     * @brief Evaluate the compiled expression.
+     *
+     * This function does not need the GIL.
+     *
+     * @param[out] value The value of the expression.
+     *
+     * @return True on success, false if the expression must be evaluated
+     * with Expression::getValueAsAny() instead.
+     */
+    bool evaluate(App::any& value) const;
+
+    /// The value type the program operates on.
+    struct Value
+    {
+        /// Mirrors the Python type the regular evaluation would produce.
+        enum class Kind
+        {
+            Boolean,
+            Integer,
+            Float,
+            Quantity,
+        };
+
+        Base::Quantity quantity;
+        Kind kind {Kind::Float};
+    };
+
+    /**
+     * @brief Evaluate the compiled expression.
+     *
+     * Same as above, but returns the value together with the type the
+     * regular evaluation would produce, e.g. to tell booleans from integers.
+     */
+    bool evaluate(Value& value) const;
+
+private:
+    enum class OpCode
+    {
+        Push,         ///< Push a constant
+        Load,         ///< Push the value of a property
+        Unary,        ///< Apply a unary operator to the top of the stack
+        Binary,       ///< Apply a binary operator to the two topmost values
+        Function,     ///< Call a scalar function with 'count' arguments
+        Jump,         ///< Continue at 'target'
+        JumpIfFalse,  ///< Pop a value and continue at 'target' if it is false
+    };
+
+    struct Instruction
+    {
+        OpCode code;
+        int op {0};
+        std::size_t count {0};
+        std::size_t target {0};
+        Value constant;
+        const VariableExpression* variable {nullptr};
+    };
+
+    bool compileNode(const Expression* expr, std::size_t& depth);
+    void foldConstants(std::size_t start);
+    bool run(std::size_t start, std::size_t end, std::vector<Value>& stack) const;
+
+    std::shared_ptr<const Expression> expression;
+    std::vector<Instruction> program;
+    std::size_t stackSize {0};
+};
+
+}  // namespace App
@@ -35,8 +35,10 @@
 #include <vector>
 #include <list>
 #include <algorithm>
+#include <atomic>
 #include <filesystem>
 #include <format>
+#include <future>
 #include <optional>
 
 #include <boost/algorithm/string.hpp>
@@ -46,6 +48,7 @@
 
 #include <boost/regex.hpp>
 #include <random>
+#include <thread>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -1253,6 +1256,42 @@ void DocumentP::checkStringHasher(const Base::XMLReader& reader)
     }
 }
 
+// FileInfo::size() is limited to 4 GB
+static std::uintmax_t archiveFileSize(const std::string& name)
+{
+    std::error_code ec;
+    auto size = fs::file_size(Base::FileInfo::stringToPath(name), ec);
+    return ec ? 0 : size;
+}
+
+void DocumentP::setArchive(const std::string& name)
+{
+    Base::FileInfo fi(name);
+    archiveName = name;
+    archiveTime = fi.lastModified().getTime_t();
+    archiveSize = archiveFileSize(name);
+}
+
+void DocumentP::addArchiveFile(const Base::Persistence* object, const std::string& fileName)
+{
+    if (auto prop = dynamic_cast<const Property*>(object)) {
+        auto mutableProp = const_cast<Property*>(prop);
+        mutableProp->setStatus(Property::Saved, true);
+        mutableProp->onDocFileArchived();
+        archiveFiles[prop] = fileName;
+    }
+}
+
+bool DocumentP::isArchiveUnchanged() const
+{
+    if (archiveName.empty()) {
+        return false;
+    }
+    Base::FileInfo fi(archiveName);
+    return fi.exists() && fi.lastModified().getTime_t() == archiveTime
+        && archiveFileSize(archiveName) == archiveSize;
+}
+
 std::pair<bool, int> Document::addStringHasher(const StringHasherRef& hasher) const
 {
     if (!hasher) {
@@ -2027,8 +2066,24 @@ bool Document::saveToFile(const char* filename) const
 
         writer.setComment("FreeCAD Document");
         writer.setLevel(compression);
+        writer.setParallelCompression(hGrp->GetBool("ParallelCompression", true));
         writer.putNextEntry("Document.xml");
 
+        // The previous archive can only be read while writing to a temporary file
+        if (policy && hGrp->GetBool("IncrementalSave", true) && d->isArchiveUnchanged()) {
+            writer.setPreviousArchive(
+                d->archiveName,
+                [this](const Base::Persistence* object, const std::string& fileName) {
+                    auto prop = dynamic_cast<const Property*>(object);
+                    if (!prop || !prop->testStatus(Property::Saved)
+                        || !prop->isDocFileUnchanged()) {
+                        return false;
+                    }
+                    auto it = d->archiveFiles.find(prop);
+                    return it != d->archiveFiles.end() && it->second == fileName;
+                });
+        }
+
         if (hGrp->GetBool("SaveBinaryBrep", false)) {
             writer.setMode("BinaryBrep");
         }
@@ -2054,6 +2109,12 @@ bool Document::saveToFile(const char* filename) const
         }
 
         GetApplication().signalSaveDocument(*this);
+
+        d->archiveName.clear();
+        d->archiveFiles.clear();
+        for (const auto& entry : writer.getFileList()) {
+            d->addArchiveFile(entry.Object, entry.FileName);
+        }
     }
 
     if (policy) {
@@ -2089,6 +2150,8 @@ bool Document::saveToFile(const char* filename) const
         backupPolicy.apply(fn, nativePath);
     }
 
+    d->setArchive(nativePath);
+
     signalFinishSave(*this, filename);
 
     return true;
@@ -2180,6 +2243,11 @@ void Document::restore(const char* filename,
     if (!reader.isValid()) {
         throw Base::FileException("Error reading compression file", filename);
     }
+    reader.setConcurrentRestore(
+        GetApplication()
+            .GetParameterGroupByPath("User parameter:BaseApp/Preferences/Document")
+            ->GetBool("ConcurrentRestore", false)
+    );
 
     GetApplication().signalStartRestoreDocument(*this);
     setStatus(Document::Restoring, true);
@@ -2208,6 +2276,14 @@ void Document::restore(const char* filename,
 
     DocumentP::checkStringHasher(reader);
 
+    d->setArchive(fi.filePath());
+    d->archiveFiles.clear();
+    for (const auto& entry : reader.FileList) {
+        if (!reader.hasReadFailed(entry.FileName)) {
+            d->addArchiveFile(entry.Object, entry.FileName);
+        }
+    }
+
     if (reader.testStatus(Base::XMLReader::ReaderStatus::PartialRestore)) {
         setStatus(Document::PartialRestore, true);
         Base::Console().error("There were errors while loading the file. Some data might have been "
@@ -2924,10 +3000,13 @@ int Document::recompute(const std::vector<DocumentObject*>& objs,
         GetApplication().GetParameterGroupByPath("User parameter:BaseApp/Preferences/Document");
     bool canAbort = hGrp->GetBool("CanAbortRecompute", true);
 
+    bool parallel = GetApplication().isParallelRecomputeEnabled();
+
     tracker.checkpoint("pre-recompute & topo sort");
 
     try {
         std::set<DocumentObject*> filter;
+        std::set<DocumentObject*> precomputed;
         size_t idx = 0;
         // maximum two passes to allow some form of dependency inversion
         for (int passes = 0; passes < 2 && idx < topoSortedObjects.size(); ++passes) {
@@ -2942,6 +3021,15 @@ int Document::recompute(const std::vector<DocumentObject*>& objs,
                 if (!obj->isAttachedToDocument() || filter.find(obj) != filter.end()) {
                     continue;
                 }
+                // Only the results of independent objects are computed concurrently,
+                // they are applied by the serial recompute below in the usual order.
+                if (parallel && !precomputed.contains(obj) && obj->canRecomputeConcurrently()) {
+                    auto batch = d->collectRecomputeBatch(topoSortedObjects, idx, filter);
+                    if (batch.size() > 1) {
+                        _computeConcurrently(batch);
+                        precomputed.insert(batch.begin(), batch.end());
+                    }
+                }
                 // ask the object if it should be recomputed
                 bool doRecompute = false;
                 if (obj->mustRecompute()) {
@@ -3306,6 +3394,65 @@ int Document::_recomputeFeature(DocumentObject* Feat) // NOLINT
     return 0;
 }
 
+std::vector<DocumentObject*>
+DocumentP::collectRecomputeBatch(const std::vector<DocumentObject*>& objects,
+                                 size_t start,
+                                 const std::set<DocumentObject*>& filter)
+{
+    // The objects are sorted with dependencies first, so every object from
+    // 'start' on whose dependencies are neither in the batch nor left behind
+    // for the serial pass can be recomputed right away. Objects left behind
+    // are blocked, and so is everything depending on them.
+    static constexpr size_t maxLookAhead = 1024;
+
+    std::vector<DocumentObject*> batch;
+    std::unordered_set<DocumentObject*> pending;
+    size_t end = std::min(objects.size(), start + maxLookAhead);
+    for (size_t i = start; i < end; ++i) {
+        auto obj = objects[i];
+        if (!obj->isAttachedToDocument() || filter.contains(obj)) {
+            continue;
+        }
+        auto outList = obj->getOutList();
+        bool blocked = std::ranges::any_of(outList, [&pending](DocumentObject* dep) {
+            return pending.contains(dep);
+        });
+        if (!blocked && obj->canRecomputeConcurrently() && obj->mustRecompute()) {
+            batch.push_back(obj);
+        }
+        else if (i == start) {
+            break;
+        }
+        pending.insert(obj);
+    }
+    return batch;
+}
+
+void Document::_computeConcurrently(const std::vector<DocumentObject*>& objs)
+{
+    FC_LOG("Computing " << objs.size() << " objects concurrently");
+
+    std::atomic<size_t> next {0};
+    auto worker = [&]() {
+        for (size_t i = next++; i < objs.size(); i = next++) {
+            objs[i]->computeConcurrently();
+        }
+    };
+
+    // The GIL stays held, so that no Python code changes the document while
+    // the workers read its properties.
+    size_t threads = std::min<size_t>(std::max(1U, std::thread::hardware_concurrency()), objs.size());
+    std::vector<std::future<void>> futures;
+    futures.reserve(threads - 1);
+    for (size_t i = 1; i < threads; ++i) {
+        futures.push_back(std::async(std::launch::async, worker));
+    }
+    worker();
+    for (auto& future : futures) {
+        future.get();
+    }
+}
+
 bool Document::recomputeFeature(DocumentObject* feature, bool recursive)
 {
     // delete recompute log
@@ -1422,6 +1422,17 @@ protected:
      */
     int _recomputeFeature(DocumentObject* Feat);
 
+    /**
+     * @brief Compute the results of a set of mutually independent objects concurrently.
+     *
+     * Calls DocumentObject::computeConcurrently() of the objects on a pool of
+     * threads. The results are applied when the objects are recomputed.
+     *
+     * @param[in] objs The objects to compute. None of them may depend on
+     * another one of the set.
+     */
+    void _computeConcurrently(const std::vector<DocumentObject*>& objs);
+
     /// Clear the redos.
     void _clearRedos();
 
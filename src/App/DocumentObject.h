@@ -1323,6 +1323,31 @@ public:
         return true;
     }
 
+    /**
+     * @brief Whether this object can compute its result concurrently with other objects.
+     *
+     * When parallel recompute is enabled, computeConcurrently() of objects
+     * returning true that do not depend on each other is called at the same
+     * time on a pool of threads.
+     */
+    virtual bool canRecomputeConcurrently() const
+    {
+        return false;
+    }
+
+    /**
+     * @brief Compute the result of the next execute() call on a worker thread.
+     *
+     * Only reads the properties of this object and of its dependencies. It
+     * must not change any property, emit signals or run Python code, and must
+     * not throw. The result is kept by the object until execute() is called
+     * on the recomputing thread, in the usual recompute order, where it is
+     * applied instead of being computed again. A result must be discarded if
+     * the properties it was computed from change in the meantime.
+     */
+    virtual void computeConcurrently()
+    {}
+
     /**
      * @brief Called when an element reference is updated.
      *
@@ -2157,8 +2157,6 @@ Base::Vector3d FunctionExpression::extractVectorArgument(
 
 Py::Object FunctionExpression::evaluate(const Expression *expr, int f, const std::vector<Expression*> &args)
 {
-    using std::numbers::pi;
-
     if(!expr || !expr->getOwner())
         _EXPR_THROW("Invalid owner.", expr);
 
@@ -2448,6 +2446,30 @@ Py::Object FunctionExpression::evaluate(const Expression *expr, int f, const std
         v3 = pyToQuantity(e3,expr,"Invalid third argument.");
     }
 
+    switch (f) {
+    case ROTATIONX:
+    case ROTATIONY:
+    case ROTATIONZ:
+        if (!(v1.isDimensionlessOrUnit(Unit::Angle)))
+            _EXPR_THROW("Unit must be either empty or an angle.", expr);
+
+        return Py::asObject(new Base::RotationPy(Base::Rotation(
+            Vector3d(static_cast<double>(f == ROTATIONX), static_cast<double>(f == ROTATIONY), static_cast<double>(f == ROTATIONZ)),
+            Base::toRadians(v1.getValue()))));
+    case TRANSLATIONM:
+        if (v1.isDimensionlessOrUnit(Unit::Length) && v2.isDimensionlessOrUnit(Unit::Length) && v3.isDimensionlessOrUnit(Unit::Length))
+            return translationMatrix(v1.getValue(), v2.getValue(), v3.getValue());
+        _EXPR_THROW("Translation units must be a length or dimensionless.", expr);
+    }
+
+    return Py::asObject(new QuantityPy(new Quantity(evaluateScalar(expr, f, args.size(), v1, v2, v3))));
+}
+
+Quantity FunctionExpression::evaluateScalar(const Expression *expr, int f, std::size_t nargs,
+        const Quantity &v1, const Quantity &v2, const Quantity &v3)
+{
+    using std::numbers::pi;
+
     double output;
     Unit unit;
     double scaler = 1;
@@ -2459,9 +2481,6 @@ Py::Object FunctionExpression::evaluate(const Expression *expr, int f, const std
     case COS:
     case SIN:
     case TAN:
-    case ROTATIONX:
-    case ROTATIONY:
-    case ROTATIONZ:
         if (!(v1.isDimensionlessOrUnit(Unit::Angle)))
             _EXPR_THROW("Unit must be either empty or an angle.", expr);
 
@@ -2501,7 +2520,7 @@ Py::Object FunctionExpression::evaluate(const Expression *expr, int f, const std
         unit = v1.getUnit().cbrt();
         break;
     case ATAN2:
-        if (e2.isNone())
+        if (nargs < 2)
             _EXPR_THROW("Invalid second argument.",expr);
 
         if (v1.getUnit() != v2.getUnit())
@@ -2510,14 +2529,14 @@ Py::Object FunctionExpression::evaluate(const Expression *expr, int f, const std
         scaler = 180.0 / pi;
         break;
     case MOD:
-        if (e2.isNone())
+        if (nargs < 2)
             _EXPR_THROW("Invalid second argument.",expr);
         if (v1.getUnit() != v2.getUnit() && !v1.isDimensionless() && !v2.isDimensionless())
             _EXPR_THROW("Units must be equal or dimensionless.",expr);
         unit = v1.getUnit();
         break;
     case POW: {
-        if (e2.isNone())
+        if (nargs < 2)
             _EXPR_THROW("Invalid second argument.",expr);
 
         if (!v2.isDimensionless())
@@ -2535,23 +2554,17 @@ Py::Object FunctionExpression::evaluate(const Expression *expr, int f, const std
     }
     case HYPOT:
     case CATH:
-        if (e2.isNone())
+        if (nargs < 2)
             _EXPR_THROW("Invalid second argument.",expr);
         if (v1.getUnit() != v2.getUnit())
             _EXPR_THROW("Units must be equal.",expr);
 
-        if (args.size() > 2) {
-            if (e3.isNone())
-                _EXPR_THROW("Invalid second argument.",expr);
+        if (nargs > 2) {
             if (v2.getUnit() != v3.getUnit())
                 _EXPR_THROW("Units must be equal.",expr);
         }
         unit = v1.getUnit();
         break;
-    case TRANSLATIONM:
-        if (v1.isDimensionlessOrUnit(Unit::Length) && v2.isDimensionlessOrUnit(Unit::Length) && v3.isDimensionlessOrUnit(Unit::Length))
-            break;
-        _EXPR_THROW("Translation units must be a length or dimensionless.", expr);
     case NOT:
         unit = Unit();
         break;
@@ -2619,11 +2632,11 @@ Py::Object FunctionExpression::evaluate(const Expression *expr, int f, const std
         break;
     }
     case HYPOT: {
-        output = sqrt(pow(v1.getValue(), 2) + pow(v2.getValue(), 2) + (!e3.isNone() ? pow(v3.getValue(), 2) : 0));
+        output = sqrt(pow(v1.getValue(), 2) + pow(v2.getValue(), 2) + (nargs > 2 ? pow(v3.getValue(), 2) : 0));
         break;
     }
     case CATH: {
-        output = sqrt(pow(v1.getValue(), 2) - pow(v2.getValue(), 2) - (!e3.isNone() ? pow(v3.getValue(), 2) : 0));
+        output = sqrt(pow(v1.getValue(), 2) - pow(v2.getValue(), 2) - (nargs > 2 ? pow(v3.getValue(), 2) : 0));
         break;
     }
     case ROUND:
@@ -2638,14 +2651,6 @@ Py::Object FunctionExpression::evaluate(const Expression *expr, int f, const std
     case FLOOR:
         output = floor(value);
         break;
-    case ROTATIONX:
-    case ROTATIONY:
-    case ROTATIONZ:
-        return Py::asObject(new Base::RotationPy(Base::Rotation(
-            Vector3d(static_cast<double>(f == ROTATIONX), static_cast<double>(f == ROTATIONY), static_cast<double>(f == ROTATIONZ)),
-            value)));
-    case TRANSLATIONM:
-        return translationMatrix(v1.getValue(), v2.getValue(), v3.getValue());
     case NOT:
         output = asBool(value) ? 0 : 1;
         break;
@@ -2653,7 +2658,7 @@ Py::Object FunctionExpression::evaluate(const Expression *expr, int f, const std
         _EXPR_THROW("Unknown function: " << f,0);
     }
 
-    return Py::asObject(new QuantityPy(new Quantity(scaler * output, unit)));
+    return Quantity(scaler * output, unit);
 }
 
 Py::Object FunctionExpression::_getPyValue() const {
@@ -2897,6 +2902,13 @@ const Property * VariableExpression::getProperty() const
         throw Expression::Exception(var.resolveErrorString().c_str());
 }
 
+const Property * VariableExpression::getWholeProperty() const
+{
+    if (!components.empty())
+        return nullptr;
+    return var.getWholeProperty();
+}
+
 void VariableExpression::addComponent(Component *c) {
     do {
         if(!components.empty())
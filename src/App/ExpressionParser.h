@@ -277,6 +277,21 @@ public:
 
     int priority() const override;
 
+    Expression* getCondition() const
+    {
+        return condition;
+    }
+
+    Expression* getTrueExpression() const
+    {
+        return trueExpr;
+    }
+
+    Expression* getFalseExpression() const
+    {
+        return falseExpr;
+    }
+
 protected:
     Expression* _copy() const override;
     void _visit(ExpressionVisitor& v) override;
@@ -409,6 +424,26 @@ public:
     static Py::Object
     evaluate(const Expression* owner, int type, const std::vector<Expression*>& args);
 
+    /**
+     * @brief Evaluate a function that maps numbers to a number.
+     *
+     * This is the part of evaluate() that does not depend on Python, for all
+     * functions from ABS to TRUNC and NOT.
+     *
+     * @param[in] owner The expression used for error reporting.
+     * @param[in] type The function to evaluate.
+     * @param[in] nargs The number of given arguments.
+     * @param[in] v1, v2, v3 The arguments, unused ones are ignored.
+     *
+     * @return The function value.
+     */
+    static Base::Quantity evaluateScalar(const Expression* owner,
+                                         int type,
+                                         std::size_t nargs,
+                                         const Base::Quantity& v1,
+                                         const Base::Quantity& v2,
+                                         const Base::Quantity& v3);
+
     Function getFunction() const
     {
         return f;
@@ -495,6 +530,14 @@ public:
      */
     const App::Property* getProperty() const;
 
+    /**
+     * @brief Find the property this expression refers to as a whole.
+     *
+     * @return The property if the expression refers to a regular property
+     * without any sub-path or component, or nullptr otherwise.
+     */
+    const App::Property* getWholeProperty() const;
+
     void addComponent(Component* component) override;
 
 protected:
@@ -355,6 +355,12 @@ public:
         return imp->supportsAsyncRecompute() == FeaturePythonImp::Accepted;
     }
 
+    bool canRecomputeConcurrently() const override
+    {
+        // the Python proxy may take part in execute()
+        return false;
+    }
+
     /**
      * @brief Called when a property is edited by the user.
      *
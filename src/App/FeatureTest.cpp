@@ -435,3 +435,47 @@ DocumentObjectExecReturn* FeatureTestAsyncBlocker::execute()
     state.changed.wait(lock, [&state] { return state.proceed; });
     return StdReturn;
 }
+
+// ----------------------------------------------------------------------------
+
+PROPERTY_SOURCE(App::FeatureTestConcurrent, App::DocumentObject)
+
+std::vector<std::string> FeatureTestConcurrent::executionOrder;
+
+FeatureTestConcurrent::FeatureTestConcurrent()
+{
+    ADD_PROPERTY(Input, (0));
+    ADD_PROPERTY(Source, (nullptr));
+    ADD_PROPERTY(Result, (0));
+}
+
+FeatureTestConcurrent::~FeatureTestConcurrent() = default;
+
+long FeatureTestConcurrent::compute() const
+{
+    auto source = freecad_cast<FeatureTestConcurrent*>(Source.getValue());
+    return Input.getValue() + (source ? source->Result.getValue() : 0);
+}
+
+void FeatureTestConcurrent::computeConcurrently()
+{
+    computed = compute();
+}
+
+void FeatureTestConcurrent::onBeforeChange(const Property* prop)
+{
+    if (prop != &Result) {
+        computed.reset();
+    }
+    DocumentObject::onBeforeChange(prop);
+}
+
+DocumentObjectExecReturn* FeatureTestConcurrent::execute()
+{
+    computedConcurrently = computed.has_value();
+    long value = computed ? *computed : compute();
+    computed.reset();
+    executionOrder.emplace_back(getNameInDocument());
+    Result.setValue(value);
+    return StdReturn;
+}
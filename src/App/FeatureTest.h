@@ -26,6 +26,9 @@
 #pragma once
 
 #include <chrono>
+#include <optional>
+#include <string>
+#include <vector>
 
 #include "DocumentObject.h"
 #include "PropertyGeo.h"
@@ -237,5 +240,35 @@ public:
     static void releaseBlocker();
 };
 
+/// Adds Input to the Result of its Source, computed concurrently if possible
+class AppExport FeatureTestConcurrent: public DocumentObject
+{
+    PROPERTY_HEADER_WITH_OVERRIDE(App::FeatureTestConcurrent);
+
+public:
+    FeatureTestConcurrent();
+    ~FeatureTestConcurrent() override;
+    DocumentObjectExecReturn* execute() override;
+    bool canRecomputeConcurrently() const override { return true; }
+    void computeConcurrently() override;
+
+    App::PropertyInteger Input;
+    App::PropertyLink Source;
+    App::PropertyInteger Result;
+
+    /// Whether the last result was computed by computeConcurrently()
+    bool computedConcurrently = false;
+    /// The names of the executed objects, in the order of execution
+    static std::vector<std::string> executionOrder;
+
+protected:
+    void onBeforeChange(const Property* prop) override;
+
+private:
+    long compute() const;
+
+    std::optional<long> computed;
+};
+
 
 }  // namespace App
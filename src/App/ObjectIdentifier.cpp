@@ -1218,6 +1218,17 @@ Property* ObjectIdentifier::getProperty(int* ptype) const
     return result.resolvedProperty;
 }
 
+Property* ObjectIdentifier::getWholeProperty() const
+{
+    ResolveResults result(*this);
+    if (result.propertyType != PseudoNone
+        || components.size() - result.propertyIndex != 1
+        || !components[result.propertyIndex].isSimple()) {
+        return nullptr;
+    }
+    return result.resolvedProperty;
+}
+
 Property* ObjectIdentifier::resolveProperty(const App::DocumentObject* obj,
                                             const char* propertyName,
                                             App::DocumentObject*& sobj,
@@ -988,6 +988,14 @@ public:
      */
     App::Property* getProperty(int* ptype = nullptr) const;
 
+    /**
+     * @brief Get the property this object identifier represents as a whole.
+     *
+     * @return A pointer to the property if the identifier refers to a regular
+     * (non-pseudo) property without any sub-path, or `nullptr` otherwise.
+     */
+    App::Property* getWholeProperty() const;
+
     /**
      * @brief Create a canonical representation of the object identifier.
      *
@@ -277,6 +277,7 @@ void Property::touch()
         father->onChanged(this);
     }
     StatusBits.set(Touched);
+    StatusBits.reset(Saved);
 }
 
 void Property::setReadOnly(bool readOnly)
@@ -297,6 +298,7 @@ void Property::hasSetValue()
         }
     }
     StatusBits.set(Touched);
+    StatusBits.reset(Saved);
 }
 
 void Property::aboutToSetValue()
@@ -335,7 +337,8 @@ void Property::setStatusValue(unsigned long status)
         |(1<<PropOutput)
         |(1<<PropHidden)
         |(1<<PropNoPersist)
-        |(1<<Busy);
+        |(1<<Busy)
+        |(1<<Saved);
     // clang-format on
 
     status &= ~mask;
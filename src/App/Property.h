@@ -111,6 +111,8 @@ public:
         UserEdit = 17,
         /// Do not propagate changes of the property to its container
         DisableNotify = 18,
+        /// Whether the value is unchanged since its file was saved or restored.
+        Saved = 19,
 
         // The following bits are corresponding to PropertyType set when the
         // property added. These types are meant to be static, and cannot be
@@ -537,6 +539,32 @@ public:
      */
     virtual void beforeSave() const {}
 
+    /**
+     * @brief Callback for when the file of the property was saved or restored.
+     *
+     * This method is called by the document after the data of SaveDocFile()
+     * was written to or read from a project file.  Subclasses that implement
+     * isDocFileUnchanged() can use it to remember the state of their data.
+     */
+    virtual void onDocFileArchived() {}
+
+    /**
+     * @brief Check if SaveDocFile() would write the same data as last time.
+     *
+     * When saving a document again, the file of a property that didn't
+     * change since onDocFileArchived() is copied from the previous project
+     * file.  Changes through touch() and hasSetValue() are already detected
+     * by the document; subclasses override this method to confirm that no
+     * other change, e.g. of data kept outside of the property value, was
+     * made.  The default returns false, so the file is always written again.
+     *
+     * @return True if the data of SaveDocFile() is unchanged.
+     */
+    virtual bool isDocFileUnchanged() const
+    {
+        return false;
+    }
+
     friend class PropertyContainer;
     friend struct PropertyData;
     friend class DynamicProperty;
@@ -252,6 +252,11 @@ void PropertyContainer::Save (Base::Writer &writer) const
         }
     }
 
+    // The Saved bit only describes the last archive of this session
+    auto persistentStatus = [](const Property* prop) {
+        return prop->getStatus() & ~(1UL << Property::Saved);
+    };
+
     writer.incInd(); // indentation for 'Properties Count'
     writer.Stream() << writer.ind() << "<Properties Count=\"" << Map.size()
                     << "\" TransientCount=\"" << transients.size() << "\">" << endl;
@@ -263,7 +268,7 @@ void PropertyContainer::Save (Base::Writer &writer) const
     for(auto prop : transients) {
         writer.Stream() << writer.ind() << "<_Property name=\"" << prop->getName()
             << "\" type=\"" << prop->getTypeId().getName()
-            << "\" status=\"" << prop->getStatus() << "\"/>" << std::endl;
+            << "\" status=\"" << persistentStatus(prop) << "\"/>" << std::endl;
     }
     writer.decInd();
 
@@ -276,7 +281,7 @@ void PropertyContainer::Save (Base::Writer &writer) const
 
         dynamicProps.save(it.second,writer);
 
-        auto status = it.second->getStatus();
+        auto status = persistentStatus(it.second);
         if(status)
             writer.Stream() << "\" status=\"" << status;
         writer.Stream() << "\">";
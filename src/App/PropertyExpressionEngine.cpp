@@ -37,6 +37,7 @@
 #include <CXX/Objects.hxx>
 
 #include "PropertyExpressionEngine.h"
+#include "CompiledExpression.h"
 #include "ExpressionVisitors.h"
 
 
@@ -729,9 +730,18 @@ DocumentObjectExecReturn* App::PropertyExpressionEngine::execute(ExecuteOption o
         App::any value;
         try {
             // Evaluate expression
-            std::shared_ptr<App::Expression> expression = expressions[*it].expression;
+            ExpressionInfo& info = expressions[*it];
+            std::shared_ptr<App::Expression> expression = info.expression;
             if (expression) {
-                value = expression->getValueAsAny();
+                // Plain numeric expressions are evaluated without Python. The
+                // compiled form refuses everything else, including any error
+                // case, which is then handled by the regular evaluation.
+                if (!info.compiled || info.compiled->getExpression() != expression) {
+                    info.compiled = CompiledExpression::compile(expression);
+                }
+                if (!info.compiled->evaluate(value)) {
+                    value = expression->getValueAsAny();
+                }
 
                 // Enable value comparison for all expression bindings to reduce
                 // unnecessary touch and recompute.
@@ -47,6 +47,7 @@ class DocumentObject;
 class DocumentObjectExecReturn;
 class ObjectIdentifier;
 class Expression;
+class CompiledExpression;
 using ExpressionPtr = std::unique_ptr<Expression>;
 
 class AppExport PropertyExpressionContainer: public App::PropertyXLinkContainer
@@ -150,6 +151,8 @@ public:
     struct ExpressionInfo
     {
         std::shared_ptr<App::Expression> expression; /**< The actual expression tree */
+        /** The expression compiled for fast evaluation, created on first use */
+        std::shared_ptr<App::CompiledExpression> compiled;
         bool busy;
 
         explicit ExpressionInfo(
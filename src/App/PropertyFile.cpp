@@ -32,6 +32,7 @@
 #include <Base/Tools.h>
 
 #include <array>
+#include <system_error>
 
 #include "PropertyFile.h"
 #include "Document.h"
@@ -555,6 +556,37 @@ void PropertyFileIncluded::RestoreDocFile(Base::Reader& reader)
     hasSetValue();
 }
 
+std::optional<PropertyFileIncluded::FileStamp>
+PropertyFileIncluded::getFileStamp(const std::string& fileName)
+{
+    if (fileName.empty()) {
+        return {};
+    }
+    std::error_code ec;
+    auto path = Base::FileInfo::stringToPath(fileName);
+    auto size = std::filesystem::file_size(path, ec);
+    if (ec) {
+        return {};
+    }
+    auto time = std::filesystem::last_write_time(path, ec);
+    if (ec) {
+        return {};
+    }
+    return FileStamp(size, time);
+}
+
+void PropertyFileIncluded::onDocFileArchived()
+{
+    m_archivedStamp = getFileStamp(_cValue);
+}
+
+bool PropertyFileIncluded::isDocFileUnchanged() const
+{
+    // The file in the transient directory can be modified in place without setting the value
+    auto stamp = getFileStamp(_cValue);
+    return stamp && stamp == m_archivedStamp;
+}
+
 Property* PropertyFileIncluded::Copy() const
 {
     std::unique_ptr<PropertyFileIncluded> prop(new PropertyFileIncluded());
@@ -25,7 +25,11 @@
 
 #pragma once
 
+#include <cstdint>
+#include <filesystem>
+#include <optional>
 #include <string>
+#include <utility>
 
 #include "PropertyStandard.h"
 
@@ -99,6 +103,8 @@ public:
 
     void SaveDocFile(Base::Writer& writer) const override;
     void RestoreDocFile(Base::Reader& reader) override;
+    void onDocFileArchived() override;
+    bool isDocFileUnchanged() const override;
 
     Property* Copy() const override;
     void Paste(const Property& from) override;
@@ -143,7 +149,12 @@ protected:
     mutable std::string _OriginalName;
 
 private:
+    // size and modification time of a file
+    using FileStamp = std::pair<std::uintmax_t, std::filesystem::file_time_type>;
+    static std::optional<FileStamp> getFileStamp(const std::string& fileName);
+
     std::string m_filter;
+    std::optional<FileStamp> m_archivedStamp;
 };
 
 
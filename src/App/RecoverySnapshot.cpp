@@ -120,7 +120,9 @@ void writeUncompressedRecoverySnapshot(const App::Document& doc, bool saveBinary
     writeRecoverySnapshotContents(doc, writer);
 }
 
-void writeCompressedRecoverySnapshot(const App::Document& doc, bool saveBinaryBrep)
+void writeCompressedRecoverySnapshot(const App::Document& doc,
+                                     bool saveBinaryBrep,
+                                     bool parallelCompression)
 {
     std::string fileName = doc.TransientDir.getValue();
     fileName += "/fc_recovery_file.fcstd";
@@ -138,6 +140,7 @@ void writeCompressedRecoverySnapshot(const App::Document& doc, bool saveBinaryBr
 
     writer.setComment("AutoRecovery file");
     writer.setLevel(1);  // Prefer lower latency over compression ratio for autosave.
+    writer.setParallelCompression(parallelCompression);
     writeRecoverySnapshotContents(doc, writer);
 }
 
@@ -168,7 +171,9 @@ bool writeRecoverySnapshotToTransientDir(const Document& doc,
         return true;
     }
 
-    writeCompressedRecoverySnapshot(doc, options.saveBinaryBrep);
+    writeCompressedRecoverySnapshot(doc,
+                                    options.saveBinaryBrep,
+                                    params->GetBool("ParallelCompression", true));
     return true;
 }
 
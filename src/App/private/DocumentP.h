@@ -29,9 +29,12 @@
 #endif
 
 #include <map>
+#include <set>
 #include <string>
 #include <memory>
 #include <vector>
+#include <cstdint>
+#include <ctime>
 #include <unordered_map>
 #include <unordered_set>
 #include <optional>
@@ -107,6 +110,13 @@ struct DocumentP
 
     StringHasherRef Hasher {new StringHasher};
 
+    // The project file that was last read or written and the names of the
+    // property files in it, used to copy unchanged files when saving again
+    std::string archiveName;
+    std::time_t archiveTime {};
+    std::uintmax_t archiveSize {};
+    std::map<const Property*, std::string> archiveFiles;
+
     DocumentP();
 
     void addRecomputeLog(const char* why, App::DocumentObject* obj)
@@ -171,7 +181,15 @@ struct DocumentP
     topologicalSort(const std::vector<App::DocumentObject*>& objects) const;
     static std::vector<App::DocumentObject*>
     partialTopologicalSort(const std::vector<App::DocumentObject*>& objects);
+    static std::vector<App::DocumentObject*>
+    collectRecomputeBatch(const std::vector<App::DocumentObject*>& objects,
+                          size_t start,
+                          const std::set<App::DocumentObject*>& filter);
     static void checkStringHasher(const Base::XMLReader& reader);
+
+    void setArchive(const std::string& name);
+    void addArchiveFile(const Base::Persistence* object, const std::string& fileName);
+    bool isArchiveUnchanged() const;
 };
 
 }  // namespace App
@@ -78,6 +78,16 @@ void Persistence::SaveDocFile(Writer& /*writer*/) const
 void Persistence::RestoreDocFile(Reader& /*reader*/)
 {}
 
+bool Persistence::canDecodeDocFile() const
+{
+    return false;
+}
+
+std::function<void()> Persistence::decodeDocFile(Reader& /*reader*/)
+{
+    return {};
+}
+
 std::string Persistence::encodeAttribute(const std::string& str)
 {
     std::string tmp;
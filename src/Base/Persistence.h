@@ -25,6 +25,8 @@
 
 #pragma once
 
+#include <functional>
+
 #include "BaseClass.h"
 
 namespace Base
@@ -146,6 +148,19 @@ public:
      * @see Base::Reader,Base::XMLReader
      */
     virtual void RestoreDocFile(Reader& /*reader*/);
+    /** Returns true if the file requested with addFile() can be read with decodeDocFile()
+     * instead of RestoreDocFile(). The default implementation returns false.
+     */
+    virtual bool canDecodeDocFile() const;
+    /** This method is used to restore large amounts of data on a worker thread
+     * When a project is restored concurrently the reader holds a copy of the file in memory
+     * and this method is called from a worker thread, possibly at the same time as the
+     * decodeDocFile() of other objects. It must only parse the data and must not modify this
+     * object or any shared state. The returned function applies the parsed data. It is called
+     * from the main thread, in the order of the files in the project.
+     * @see canDecodeDocFile(), Base::XMLReader::setConcurrentRestore()
+     */
+    virtual std::function<void()> decodeDocFile(Reader& /*reader*/);
     /// Encodes an attribute upon saving.
     static std::string encodeAttribute(const std::string&);
     /// Replaces all characters with '_' that are not allowed in XML
@@ -22,10 +22,15 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <algorithm>
+#include <deque>
+#include <future>
 #include <map>
 #include <vector>
 #include <iostream>
+#include <sstream>
 #include <string>
+#include <thread>
 #include <xercesc/sax2/XMLReaderFactory.hpp>
 #include <xercesc/sax2/Attributes.hpp>
 #include <xercesc/util/XMLUni.hpp>
@@ -436,6 +441,17 @@ void Base::XMLReader::readBinFile(const char* filename)
     to.close();
 }
 
+namespace
+{
+struct PendingFile
+{
+    std::string FileName;
+    std::string EntryName;
+    bool Empty;
+    std::future<std::function<void()>> Result;
+};
+}  // namespace
+
 void Base::XMLReader::readFiles(zipios::ZipInputStream& zipstream) const
 {
     // It's possible that not all objects inside the document could be created, e.g. if a module
@@ -455,6 +471,45 @@ void Base::XMLReader::readFiles(zipios::ZipInputStream& zipstream) const
         // project file was created without GUI
         return;
     }
+
+    // For any exception we just continue with the next file.
+    // It doesn't matter if the last reader has read more or
+    // less data than the file size would allow.
+    // All what we need to do is to notify the user about the
+    // failure.
+    auto reportFailure = [this](const std::string& fileName, const std::string& entryName, bool empty) {
+        if (empty) {
+            Base::Console().log("Skipped empty embedded file: %s\n", entryName.c_str());
+        }
+        else {
+            Base::Console().error("Reading failed from embedded file: %s\n", entryName.c_str());
+            FailedFiles.push_back(fileName);
+        }
+    };
+
+    // Files that are decoded on worker threads. They are applied strictly in file order, so
+    // all of them are applied before the next file is restored the sequential way.
+    std::deque<PendingFile> pending;
+    const std::size_t maxPending = std::max<std::size_t>(2, std::thread::hardware_concurrency());
+    auto applyFirst = [&pending, &reportFailure]() {
+        PendingFile& file = pending.front();
+        try {
+            std::function<void()> apply = file.Result.get();
+            if (apply) {
+                apply();
+            }
+        }
+        catch (...) {
+            reportFailure(file.FileName, file.EntryName, file.Empty);
+        }
+        pending.pop_front();
+    };
+    auto applyAll = [&pending, &applyFirst]() {
+        while (!pending.empty()) {
+            applyFirst();
+        }
+    };
+
     std::vector<FileEntry>::const_iterator it = FileList.begin();
     Base::SequencerLauncher seq("Importing project files...", FileList.size());
     while (entry->isValid() && it != FileList.end()) {
@@ -467,28 +522,42 @@ void Base::XMLReader::readFiles(zipios::ZipInputStream& zipstream) const
         // If this condition is true both file names match and we can read-in the data, otherwise
         // no file name for the current entry in the zip was registered.
         if (jt != FileList.end()) {
-            try {
-                Base::Reader reader(zipstream, jt->FileName, FileVersion);
-                jt->Object->RestoreDocFile(reader);
-                if (reader.getLocalReader()) {
-                    reader.getLocalReader()->readFiles(zipstream);
+            if (_concurrent && jt->Object->canDecodeDocFile()) {
+                // Inflating the entry must be done here because the zip stream is sequential
+                std::string data;
+                data.reserve(entry->getSize());
+                data.assign(std::istreambuf_iterator<char>(zipstream), std::istreambuf_iterator<char>());
+
+                if (pending.size() >= maxPending) {
+                    applyFirst();
                 }
+
+                Base::Persistence* object = jt->Object;
+                std::string fileName = jt->FileName;
+                int version = FileVersion;
+                auto decode = [object, fileName, version, data = std::move(data)]() mutable {
+                    std::istringstream str(std::move(data));
+                    Base::Reader reader(str, fileName, version);
+                    return object->decodeDocFile(reader);
+                };
+                pending.push_back(
+                    {jt->FileName,
+                     entry->toString(),
+                     entry->getSize() == 0,
+                     std::async(std::launch::async, std::move(decode))}
+                );
             }
-            catch (...) {
-                // For any exception we just continue with the next file.
-                // It doesn't matter if the last reader has read more or
-                // less data than the file size would allow.
-                // All what we need to do is to notify the user about the
-                // failure.
-                if (entry->getSize() == 0) {
-                    Base::Console().log("Skipped empty embedded file: %s\n", entry->toString().c_str());
+            else {
+                applyAll();
+                try {
+                    Base::Reader reader(zipstream, jt->FileName, FileVersion);
+                    jt->Object->RestoreDocFile(reader);
+                    if (reader.getLocalReader()) {
+                        reader.getLocalReader()->readFiles(zipstream);
+                    }
                 }
-                else {
-                    Base::Console().error(
-                        "Reading failed from embedded file: %s\n",
-                        entry->toString().c_str()
-                    );
-                    FailedFiles.push_back(jt->FileName);
+                catch (...) {
+                    reportFailure(jt->FileName, entry->toString(), entry->getSize() == 0);
                 }
             }
             // Go to the next registered file name
@@ -506,6 +575,18 @@ void Base::XMLReader::readFiles(zipios::ZipInputStream& zipstream) const
             break;
         }
     }
+
+    applyAll();
+}
+
+void Base::XMLReader::setConcurrentRestore(bool on)
+{
+    _concurrent = on;
+}
+
+bool Base::XMLReader::isConcurrentRestore() const
+{
+    return _concurrent;
 }
 
 const char* Base::XMLReader::addFile(const char* Name, Base::Persistence* Object)
@@ -542,6 +623,17 @@ bool Base::XMLReader::isRegistered(Base::Persistence* Object) const
     return false;
 }
 
+Base::Persistence* Base::XMLReader::getFileObject(const char* Name) const
+{
+    for (const auto& it : FileList) {
+        if (it.FileName == Name) {
+            return it.Object;
+        }
+    }
+
+    return nullptr;
+}
+
 void Base::XMLReader::addName(const char* /*unused*/, const char* /*unused*/)
 {}
 
@@ -277,11 +277,19 @@ public:
     const char* addFile(const char* Name, Base::Persistence* Object);
     /// process the requested file writes
     void readFiles(zipios::ZipInputStream& zipstream) const;
+    /** Decode the files of objects that support Persistence::decodeDocFile() on worker threads.
+     * Only the inflation of the zip entries is sequential, the decoded data is still applied
+     * in the order of the files.
+     */
+    void setConcurrentRestore(bool on);
+    bool isConcurrentRestore() const;
     /// Returns whether reader has any registered filenames
     bool hasFilenames() const;
     /// returns true if reading the file \a filename has failed
     bool hasReadFailed(const std::string& filename) const;
     bool isRegistered(Base::Persistence* Object) const;
+    /// returns the object that requested to read \a Name or null
+    Base::Persistence* getFileObject(const char* Name) const;
     virtual void addName(const char*, const char*);
     virtual const char* getName(const char*) const;
     virtual bool doNameMapping() const;
@@ -380,6 +388,7 @@ private:
     XERCES_CPP_NAMESPACE::XMLPScanToken token;
     bool _valid {false};
     bool _verbose {true};
+    bool _concurrent {false};
 
 public:
     struct FileEntry
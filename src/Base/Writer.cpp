@@ -23,8 +23,16 @@
  ***************************************************************************/
 
 
+#include <algorithm>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
 #include <memory>
 #include <set>
+#include <sstream>
+#include <streambuf>
+#include <thread>
 #include <vector>
 #include <string>
 
@@ -32,6 +40,8 @@
 #include <locale>
 #include <iomanip>
 
+#include <zlib.h>
+
 #include "Writer.h"
 #include "Base64.h"
 #include "Base64Filter.h"
@@ -42,6 +52,8 @@
 #include "Tools.h"
 
 #include <boost/iostreams/filtering_stream.hpp>
+#include <zipios++/zipfile.h>
+#include <zipios++/zipheadio.h>
 #include <zipios++/zipinputstream.h>
 
 using namespace Base;
@@ -311,6 +323,17 @@ std::string Writer::addFile(const char* Name, const Base::Persistence* Object)
     return temp.FileName;
 }
 
+void Writer::addSharedFile(const std::string& Key, const std::string& FileName)
+{
+    SharedFiles.emplace(Key, FileName);
+}
+
+std::string Writer::getSharedFile(const std::string& Key) const
+{
+    auto it = SharedFiles.find(Key);
+    return it != SharedFiles.end() ? it->second : std::string();
+}
+
 void Writer::incInd()
 {
     if (indent < 1020) {
@@ -366,18 +389,319 @@ void ZipWriter::putNextEntry(const char* file, const char* obj)
     Writer::checkErrNo();
 }
 
+namespace
+{
+// Larger files are compressed while they are written, like without parallel compression
+constexpr std::size_t maxBufferedEntrySize = 32 * 1024 * 1024;
+// Limits the data of all files that wait for or are being compressed on worker threads
+constexpr std::size_t maxBufferedBytes = 128 * 1024 * 1024;
+
+// Keeps the data of a file in memory to compress it on a worker thread. When the data grows
+// beyond maxBufferedEntrySize it's passed on to the buffer returned by startStreaming.
+class EntryBuffer: public std::streambuf
+{
+public:
+    explicit EntryBuffer(std::function<std::streambuf*()> startStreaming)
+        : startStreaming(std::move(startStreaming))
+        , chunk(64 * 1024)
+    {
+        setp(chunk.data(), chunk.data() + chunk.size());
+    }
+
+    bool isStreaming() const
+    {
+        return target != nullptr;
+    }
+
+    /// Writes the remaining data, returns false if it failed
+    bool finish()
+    {
+        bool ok = sync() == 0;
+        if (error) {
+            std::rethrow_exception(error);
+        }
+        return ok;
+    }
+
+    std::string takeData()
+    {
+        return std::move(data);
+    }
+
+protected:
+    int_type overflow(int_type ch) override
+    {
+        if (sync() != 0) {
+            return traits_type::eof();
+        }
+        if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+            *pptr() = traits_type::to_char_type(ch);
+            pbump(1);
+        }
+        return traits_type::not_eof(ch);
+    }
+
+    int sync() override
+    {
+        const auto count = static_cast<std::size_t>(pptr() - pbase());
+        setp(chunk.data(), chunk.data() + chunk.size());
+        return write(chunk.data(), count) ? 0 : -1;
+    }
+
+private:
+    bool write(const char* str, std::size_t count)
+    {
+        if (error) {
+            return false;
+        }
+        if (!target && data.size() + count > maxBufferedEntrySize) {
+            // Exceptions would be swallowed by the ostream, finish() throws them instead
+            try {
+                target = startStreaming();
+            }
+            catch (...) {
+                error = std::current_exception();
+                return false;
+            }
+            if (!put(data.data(), data.size())) {
+                return false;
+            }
+            std::string().swap(data);
+        }
+        if (target) {
+            return put(str, count);
+        }
+        data.append(str, count);
+        return true;
+    }
+
+    bool put(const char* str, std::size_t count)
+    {
+        const auto size = static_cast<std::streamsize>(count);
+        return target->sputn(str, size) == size;
+    }
+
+    std::function<std::streambuf*()> startStreaming;
+    std::streambuf* target {nullptr};
+    std::exception_ptr error;
+    std::vector<char> chunk;
+    std::string data;
+};
+
+struct CompressedEntry
+{
+    std::string FileName;
+    zipios::StorageMethod Method {zipios::DEFLATED};
+    uLong Crc {};
+    uLong Size {};
+    std::string Data;
+};
+
+CompressedEntry compressEntry(const std::string& fileName, const std::string& data, int level)
+{
+    CompressedEntry entry;
+    entry.FileName = fileName;
+    entry.Size = static_cast<uLong>(data.size());
+
+    const auto* input = reinterpret_cast<const Bytef*>(data.data());  // NOLINT
+    entry.Crc = crc32(crc32(0L, Z_NULL, 0), input, static_cast<uInt>(data.size()));
+
+    // Raw deflate stream with the same settings as zipios uses
+    z_stream zs {};
+    if (deflateInit2(&zs, level, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+        throw Base::RuntimeError("Failed to initialize compression");
+    }
+    entry.Data.resize(deflateBound(&zs, entry.Size));
+    zs.next_in = const_cast<Bytef*>(input);  // NOLINT
+    zs.avail_in = static_cast<uInt>(data.size());
+    zs.next_out = reinterpret_cast<Bytef*>(entry.Data.data());  // NOLINT
+    zs.avail_out = static_cast<uInt>(entry.Data.size());
+    int ret = deflate(&zs, Z_FINISH);
+    entry.Data.resize(zs.total_out);
+    deflateEnd(&zs);
+    if (ret != Z_STREAM_END) {
+        throw Base::RuntimeError("Failed to compress " + fileName);
+    }
+    return entry;
+}
+
+// Reads the compressed data of an entry of an existing archive
+bool readCompressedEntry(
+    zipios::ZipFile& archive,
+    std::istream& str,
+    const std::string& fileName,
+    CompressedEntry& entry
+)
+{
+    zipios::ConstEntryPointer pointer = archive.getEntry(fileName);
+    const auto* cdirEntry = dynamic_cast<const zipios::ZipCDirEntry*>(pointer.get());
+    if (!cdirEntry || !cdirEntry->isValid()) {
+        return false;
+    }
+    if (cdirEntry->getMethod() != zipios::DEFLATED && cdirEntry->getMethod() != zipios::STORED) {
+        return false;
+    }
+    // Large files are written again rather than kept in memory
+    if (cdirEntry->getCompressedSize() > maxBufferedEntrySize) {
+        return false;
+    }
+
+    try {
+        // The local header may have a different size than the central directory entry
+        str.clear();
+        str.seekg(cdirEntry->getLocalHeaderOffset());
+        zipios::ZipLocalEntry header;
+        str >> header;
+        if (!str || !header.isValid()) {
+            return false;
+        }
+
+        entry.FileName = fileName;
+        entry.Method = cdirEntry->getMethod();
+        entry.Crc = cdirEntry->getCrc();
+        entry.Size = cdirEntry->getSize();
+        entry.Data.resize(cdirEntry->getCompressedSize());
+        str.read(entry.Data.data(), static_cast<std::streamsize>(entry.Data.size()));
+        return static_cast<bool>(str);
+    }
+    catch (const std::exception&) {
+        return false;
+    }
+}
+}  // namespace
+
+void ZipWriter::setPreviousArchive(
+    const std::string& archive,
+    std::function<bool(const Base::Persistence*, const std::string&)> isUnchanged
+)
+{
+    PreviousArchive.reset();
+    PreviousStream.reset();
+    IsUnchanged = std::move(isUnchanged);
+    try {
+        auto stream = std::make_unique<Base::ifstream>(
+            Base::FileInfo(archive),
+            std::ios::in | std::ios::binary
+        );
+        if (stream->is_open()) {
+            PreviousArchive = std::make_unique<zipios::ZipFile>(archive);
+            PreviousStream = std::move(stream);
+        }
+    }
+    catch (const std::exception&) {
+        // Without the previous archive all files are written
+        PreviousArchive.reset();
+        PreviousStream.reset();
+    }
+}
+
 void ZipWriter::writeFiles()
 {
+    struct PendingEntry
+    {
+        std::future<CompressedEntry> Entry;
+        std::size_t Bytes {};
+    };
+
+    const int level = ZipStream.getLevel();
+    const std::size_t maxPending = std::max<std::size_t>(2, std::thread::hardware_concurrency());
+    std::deque<PendingEntry> pending;
+    std::size_t pendingBytes = 0;
+    auto writeFirst = [this, &pending, &pendingBytes]() {
+        CompressedEntry entry = pending.front().Entry.get();
+        pendingBytes -= pending.front().Bytes;
+        pending.pop_front();
+
+        zipios::ZipCDirEntry header(entry.FileName);
+        header.setMethod(entry.Method);
+        header.setCrc(entry.Crc);
+        header.setSize(entry.Size);
+        ZipStream.putCompressedEntry(header, entry.Data.data(), entry.Data.size());
+        Writer::checkErrNo();
+    };
+    auto addPending = [&](std::future<CompressedEntry> entry, std::size_t bytes) {
+        while (!pending.empty()
+               && (pending.size() >= maxPending || pendingBytes + bytes > maxBufferedBytes)) {
+            writeFirst();
+        }
+        pending.push_back({std::move(entry), bytes});
+        pendingBytes += bytes;
+    };
+
     // use a while loop because it is possible that while
     // processing the files new ones can be added
     size_t index = 0;
     while (index < FileList.size()) {
         FileEntry entry = FileList[index];
-        putNextEntry(entry.FileName.c_str());
+        index++;
+
+        CompressedEntry previous;
+        if (PreviousArchive && IsUnchanged(entry.Object, entry.FileName)
+            && readCompressedEntry(*PreviousArchive, *PreviousStream, entry.FileName, previous)) {
+            std::size_t bytes = previous.Data.size();
+            addPending(
+                std::async(std::launch::deferred, [previous = std::move(previous)]() mutable {
+                    return std::move(previous);
+                }),
+                bytes
+            );
+            continue;
+        }
+
+        if (!ParallelCompression) {
+            while (!pending.empty()) {
+                writeFirst();
+            }
+            putNextEntry(entry.FileName.c_str());
+            indent = 0;
+            indBuf[0] = 0;
+            entry.Object->SaveDocFile(*this);
+            continue;
+        }
+
+        Writer::putNextEntry(entry.FileName.c_str());
         indent = 0;
         indBuf[0] = 0;
-        entry.Object->SaveDocFile(*this);
-        index++;
+
+        // The entries are added in order, so all pending ones must be written before a file
+        // is compressed while it is written
+        EntryBuffer buffer([this, &pending, &writeFirst, &entry]() {
+            while (!pending.empty()) {
+                writeFirst();
+            }
+            ZipStream.putNextEntry(entry.FileName);
+            return ZipStream.rdbuf();
+        });
+        std::ostream str(&buffer);
+        str.copyfmt(ZipStream);
+        EntryStream = &str;
+        try {
+            entry.Object->SaveDocFile(*this);
+        }
+        catch (...) {
+            EntryStream = nullptr;
+            throw;
+        }
+        EntryStream = nullptr;
+
+        if (!buffer.finish()) {
+            throw Base::RuntimeError("Failed to write " + entry.FileName);
+        }
+        if (buffer.isStreaming()) {
+            Writer::checkErrNo();
+            continue;
+        }
+
+        std::string data = buffer.takeData();
+        std::size_t bytes = data.size();
+        addPending(
+            std::async(std::launch::async, compressEntry, entry.FileName, std::move(data), level),
+            bytes
+        );
+    }
+
+    while (!pending.empty()) {
+        writeFirst();
     }
 }
 
@@ -25,6 +25,8 @@
 #pragma once
 
 
+#include <functional>
+#include <map>
 #include <set>
 #include <string>
 #include <sstream>
@@ -33,6 +35,11 @@
 
 #include <zipios++/zipoutputstream.h>
 
+namespace zipios
+{
+class ZipFile;
+}
+
 #include <Base/UniqueNameManager.h>
 
 #include "FileInfo.h"
@@ -97,6 +104,13 @@ public:
     //@{
     /// add a write request of a persistent object
     std::string addFile(const char* Name, const Base::Persistence* Object);
+    /** Register the file \a FileName under a key that identifies its content
+     * Objects with identical data can then reference the file returned by getSharedFile()
+     * instead of requesting a file of their own.
+     */
+    void addSharedFile(const std::string& Key, const std::string& FileName);
+    /// returns the file registered for \a Key or an empty string
+    std::string getSharedFile(const std::string& Key) const;
     /// process the requested file storing
     virtual void writeFiles() = 0;
     /// Set mode
@@ -179,13 +193,20 @@ public:
     /// name for underlying file saves
     std::string ObjectName;
 
-protected:
     struct FileEntry
     {
         std::string FileName;
         const Base::Persistence* Object;
     };
+    /// returns the files requested with addFile()
+    const std::vector<FileEntry>& getFileList() const
+    {
+        return FileList;
+    }
+
+protected:
     std::vector<FileEntry> FileList;
+    std::map<std::string, std::string> SharedFiles;
     UniqueFileNameManager FileNameManager;
     std::vector<std::string> Errors;
     std::set<std::string> Modes;
@@ -222,15 +243,27 @@ public:
     explicit ZipWriter(std::ostream&);
     ~ZipWriter() override;
 
+    /** Writes the requested files
+     * With parallel compression the objects write their data on the calling thread into
+     * memory while worker threads compress the data of the previous files, up to a limit of
+     * buffered data. Large files are compressed while they are written, as without it.
+     * The entries are added to the zip in order.
+     */
     void writeFiles() override;
 
     std::ostream& Stream() override
     {
+        if (EntryStream) {
+            return *EntryStream;
+        }
         return ZipStream;
     }
 
     const std::ostream& Stream() const override
     {
+        if (EntryStream) {
+            return *EntryStream;
+        }
         return ZipStream;
     }
 
@@ -242,8 +275,23 @@ public:
     {
         ZipStream.setLevel(level);
     }
+    /// Compress the files of writeFiles() on worker threads, the default is off
+    void setParallelCompression(bool on)
+    {
+        ParallelCompression = on;
+    }
     void putNextEntry(const char* filename, const char* objName = nullptr) override;
 
+    /** Copy the files of unchanged objects from a previous version of the archive.
+     * writeFiles() calls \a isUnchanged for every requested file. If it returns true and
+     * \a archive has an entry of the same name, the compressed data of the entry is copied
+     * as it is and SaveDocFile() isn't called.
+     */
+    void setPreviousArchive(
+        const std::string& archive,
+        std::function<bool(const Base::Persistence*, const std::string&)> isUnchanged
+    );
+
     ZipWriter(const ZipWriter&) = delete;
     ZipWriter(ZipWriter&&) = delete;
     ZipWriter& operator=(const ZipWriter&) = delete;
@@ -251,6 +299,11 @@ public:
 
 private:
     zipios::ZipOutputStream ZipStream;
+    std::ostream* EntryStream {nullptr};
+    std::unique_ptr<zipios::ZipFile> PreviousArchive;
+    std::unique_ptr<std::istream> PreviousStream;
+    std::function<bool(const Base::Persistence*, const std::string&)> IsUnchanged;
+    bool ParallelCompression {false};
 };
 
 /** The StringWriter class
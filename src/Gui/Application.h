@@ -156,6 +156,9 @@ public:
     fastsignals::signal<void(const Gui::ViewProviderDocumentObject&)> signalResetEdit;
     /// signal on changing user edit mode
     fastsignals::signal<void(int)> signalUserEditModeChanged;
+    /// signal before the scene is measured, picked or rendered into an image, to complete
+    /// deferred updates of the view providers
+    fastsignals::signal<void()> signalFlushVisuals;
     //@}
 
     /** @name methods for Document handling */
@@ -158,6 +158,7 @@ void DlgSettingsDocumentImp::saveSettings()
     ui->prefAutoSaveTimeout->onSave();
     ui->prefCanAbortRecompute->onSave();
     ui->prefEnableAsyncRecompute->onSave();
+    ui->prefParallelCompression->onSave();
 
     int timeout = ui->prefAutoSaveTimeout->value();
     if (!ui->prefAutoSaveEnabled->isChecked()) {
@@ -194,6 +195,7 @@ void DlgSettingsDocumentImp::loadSettings()
     ui->prefAutoSaveTimeout->onRestore();
     ui->prefCanAbortRecompute->onRestore();
     ui->prefEnableAsyncRecompute->onRestore();
+    ui->prefParallelCompression->onRestore();
 }
 
 /**
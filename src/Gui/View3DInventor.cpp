@@ -770,6 +770,7 @@ RayPickInfo View3DInventor::getObjInfoRay(Base::Vector3d* startvec, Base::Vector
     float nearClippingPlane = 0.1F;
 
     RayPickInfo ret = {false, Base::Vector3d(), "", "", std::nullopt, std::nullopt, std::nullopt};
+    Application::Instance->signalFlushVisuals();
     SoRayPickAction action(getViewer()->getSoRenderManager()->getViewportRegion());
     action.setRay(SbVec3f(vsx, vsy, vsz), SbVec3f(vdx, vdy, vdz), nearClippingPlane);
     action.apply(getViewer()->getSoRenderManager()->getSceneGraph());
@@ -1712,6 +1712,8 @@ void View3DInventorViewer::resetEditingRoot(bool updateLinks)
 
 SoPickedPoint* View3DInventorViewer::getPointOnRay(const SbVec2s& pos, const ViewProvider* vp) const
 {
+    Application::Instance->signalFlushVisuals();
+
     SoPath* path {};
     if (vp == editViewProvider && pcEditingRoot->getNumChildren() > 1) {
         path = new SoPath(1);
@@ -1767,6 +1769,8 @@ SoPickedPoint* View3DInventorViewer::getPointOnRay(
     // Note: There seems to be a  bug with setRay() which causes SoRayPickAction
     // to fail to get intersections between the ray and a line
 
+    Application::Instance->signalFlushVisuals();
+
     SoPath* path {};
     if (vp == editViewProvider && pcEditingRoot->getNumChildren() > 1) {
         path = new SoPath(1);
@@ -2435,6 +2439,8 @@ void View3DInventorViewer::savePicture(
     RenderIntent intent
 ) const
 {
+    Application::Instance->signalFlushVisuals();
+
     // Save picture methods:
     // FramebufferObject -- viewer renders into FBO (no offscreen)
     // CoinOffscreenRenderer -- Coin's offscreen rendering method
@@ -4079,6 +4085,8 @@ bool View3DInventorViewer::hasClippingPlane() const
  */
 bool View3DInventorViewer::pickPoint(const SbVec2s& pos, SbVec3f& point, SbVec3f& norm) const
 {
+    Application::Instance->signalFlushVisuals();
+
     // attempting raypick in the event_cb() callback method
     SoRayPickAction rp(getSoRenderManager()->getViewportRegion());
     rp.setPoint(pos);
@@ -4102,6 +4110,8 @@ bool View3DInventorViewer::pickPoint(const SbVec2s& pos, SbVec3f& point, SbVec3f
  */
 SoPickedPoint* View3DInventorViewer::pickPoint(const SbVec2s& pos) const
 {
+    Application::Instance->signalFlushVisuals();
+
     SoRayPickAction rp(getSoRenderManager()->getViewportRegion());
     rp.setPoint(pos);
     rp.apply(getSoRenderManager()->getSceneGraph());
@@ -4293,6 +4303,8 @@ bool View3DInventorViewer::getSceneBoundBox(Base::BoundBox3d& box) const
         return false;
     }
 
+    Application::Instance->signalFlushVisuals();
+
     SoGetBoundingBoxAction action(this->getSoRenderManager()->getViewportRegion());
     SoSkipBoundingBoxElement::set(action.getState(), SoSkipBoundingGroup::EXCLUDE_BBOX);
 
@@ -49,6 +49,7 @@
 
 #include "View3DPy.h"
 
+#include "Application.h"
 #include "Camera.h"
 #include "Document.h"
 #include "Inventor/SoMouseWheelEvent.h"
@@ -1391,6 +1392,9 @@ Py::Object View3DInventorPy::getObjectInfo(const Py::Tuple& args)
         Py::Long x(tuple[0]);
         Py::Long y(tuple[1]);
 
+        // pick the shapes whose tessellation is still pending, too
+        Application::Instance->signalFlushVisuals();
+
         // As this method could be called during a SoHandleEventAction scene
         // graph traversal we must not use a second SoHandleEventAction as
         // we will get Coin warnings because of multiple scene graph traversals
@@ -1499,6 +1503,9 @@ Py::Object View3DInventorPy::getObjectsInfo(const Py::Tuple& args)
         Py::Long x(tuple[0]);
         Py::Long y(tuple[1]);
 
+        // pick the shapes whose tessellation is still pending, too
+        Application::Instance->signalFlushVisuals();
+
         // As this method could be called during a SoHandleEventAction scene
         // graph traversal we must not use a second SoHandleEventAction as
         // we will get Coin warnings because of multiple scene graph traversals
@@ -1170,6 +1170,8 @@ Base::BoundBox3d ViewProvider::getBoundingBox(
     int depth
 ) const
 {
+    // include the geometry whose tessellation is still pending
+    Application::Instance->signalFlushVisuals();
     return _getBoundingBox(subname, mat, transform, viewer, depth);
 }
 
@@ -207,9 +207,8 @@ private:
                 = static_cast<App::DocumentObjectPy*>(pObj)->getDocumentObjectPtr();
             if (obj->isDerivedFrom<Path::Feature>()) {
                 const Path::Toolpath& path = static_cast<Path::Feature*>(obj)->Path.getValue();
-                std::string gcode = path.toGCode();
                 Base::ofstream ofile(file);
-                ofile << gcode;
+                path.toGCode(ofile);
                 ofile.close();
             }
             else {
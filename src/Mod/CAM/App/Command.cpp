@@ -21,6 +21,9 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <algorithm>
+#include <bit>
+#include <charconv>
 #include <cinttypes>
 #include <iomanip>
 #include <boost/algorithm/string.hpp>
@@ -39,6 +42,258 @@ using namespace Path;
 
 TYPESYSTEM_SOURCE(Path::Command, Base::Persistence)
 
+// CommandParameters
+
+namespace
+{
+constexpr int lettersCount = 26;
+
+std::string letterKey(int letter)
+{
+    return std::string(1, static_cast<char>('A' + letter));
+}
+
+bool keyLess(const CommandParameters::value_type& entry, const std::string& key)
+{
+    return entry.first < key;
+}
+}  // namespace
+
+CommandParameters::const_iterator::const_iterator(
+    const CommandParameters* params,
+    int letter,
+    std::size_t side
+)
+    : params(params)
+    , letter(letter)
+    , side(side)
+{
+    update();
+}
+
+void CommandParameters::const_iterator::update()
+{
+    // skip to the next present letter
+    std::uint32_t remaining = letter < lettersCount ? params->letters >> letter : 0;
+    letter = remaining ? letter + std::countr_zero(remaining) : lettersCount;
+
+    bool atLetter = letter < lettersCount;
+    bool atSide = side < params->others.size();
+    if (atLetter && (!atSide || letterKey(letter) < params->others[side].first)) {
+        current = {letterKey(letter), params->values()[params->valueIndex(letter)]};
+    }
+    else if (atSide) {
+        current = params->others[side];
+    }
+}
+
+CommandParameters::const_iterator& CommandParameters::const_iterator::operator++()
+{
+    bool atSide = side < params->others.size();
+    if (letter < lettersCount && (!atSide || letterKey(letter) < params->others[side].first)) {
+        ++letter;
+    }
+    else {
+        ++side;
+    }
+    update();
+    return *this;
+}
+
+CommandParameters::const_iterator CommandParameters::const_iterator::operator++(int)
+{
+    const_iterator previous = *this;
+    ++*this;
+    return previous;
+}
+
+CommandParameters::CommandParameters(const std::map<std::string, double>& parameters)
+{
+    for (const auto& [key, value] : parameters) {
+        (*this)[key] = value;
+    }
+}
+
+int CommandParameters::letterIndex(const std::string& key)
+{
+    if (key.size() == 1 && key[0] >= 'A' && key[0] <= 'Z') {
+        return key[0] - 'A';
+    }
+    return -1;
+}
+
+int CommandParameters::valueIndex(int letter) const
+{
+    return std::popcount(letters & ((std::uint32_t(1) << letter) - 1));
+}
+
+double* CommandParameters::values()
+{
+    return spilledValues.empty() ? inlineValues.data() : spilledValues.data();
+}
+
+const double* CommandParameters::values() const
+{
+    return spilledValues.empty() ? inlineValues.data() : spilledValues.data();
+}
+
+bool CommandParameters::empty() const
+{
+    return letters == 0 && others.empty();
+}
+
+std::size_t CommandParameters::size() const
+{
+    return std::popcount(letters) + others.size();
+}
+
+void CommandParameters::clear()
+{
+    letters = 0;
+    spilledValues.clear();
+    others.clear();
+}
+
+bool CommandParameters::contains(char key) const
+{
+    if (key >= 'A' && key <= 'Z') {
+        return letters & (std::uint32_t(1) << (key - 'A'));
+    }
+    return contains(std::string(1, key));
+}
+
+bool CommandParameters::contains(const std::string& key) const
+{
+    int letter = letterIndex(key);
+    if (letter >= 0) {
+        return contains(key[0]);
+    }
+    auto it = std::lower_bound(others.begin(), others.end(), key, keyLess);
+    return it != others.end() && it->first == key;
+}
+
+double CommandParameters::get(char key, double fallback) const
+{
+    if (key >= 'A' && key <= 'Z') {
+        int letter = key - 'A';
+        if (letters & (std::uint32_t(1) << letter)) {
+            return values()[valueIndex(letter)];
+        }
+        return fallback;
+    }
+    return get(std::string(1, key), fallback);
+}
+
+double CommandParameters::get(const std::string& key, double fallback) const
+{
+    int letter = letterIndex(key);
+    if (letter >= 0) {
+        return get(key[0], fallback);
+    }
+    auto it = std::lower_bound(others.begin(), others.end(), key, keyLess);
+    return it != others.end() && it->first == key ? it->second : fallback;
+}
+
+double& CommandParameters::operator[](char key)
+{
+    if (key < 'A' || key > 'Z') {
+        return (*this)[std::string(1, key)];
+    }
+
+    int letter = key - 'A';
+    int index = valueIndex(letter);
+    if (letters & (std::uint32_t(1) << letter)) {
+        return values()[index];
+    }
+
+    int count = std::popcount(letters);
+    if (count == inlineCapacity && spilledValues.empty()) {
+        spilledValues.assign(inlineValues.begin(), inlineValues.end());
+    }
+    if (spilledValues.empty()) {
+        std::copy_backward(
+            inlineValues.begin() + index,
+            inlineValues.begin() + count,
+            inlineValues.begin() + count + 1
+        );
+        inlineValues[index] = 0.0;
+    }
+    else {
+        spilledValues.insert(spilledValues.begin() + index, 0.0);
+    }
+    letters |= std::uint32_t(1) << letter;
+    return values()[index];
+}
+
+double& CommandParameters::operator[](const std::string& key)
+{
+    int letter = letterIndex(key);
+    if (letter >= 0) {
+        return (*this)[key[0]];
+    }
+    auto it = std::lower_bound(others.begin(), others.end(), key, keyLess);
+    if (it == others.end() || it->first != key) {
+        it = others.insert(it, {key, 0.0});
+    }
+    return it->second;
+}
+
+std::size_t CommandParameters::erase(const std::string& key)
+{
+    int letter = letterIndex(key);
+    if (letter >= 0) {
+        if (!(letters & (std::uint32_t(1) << letter))) {
+            return 0;
+        }
+        int index = valueIndex(letter);
+        if (spilledValues.empty()) {
+            int count = std::popcount(letters);
+            std::copy(
+                inlineValues.begin() + index + 1,
+                inlineValues.begin() + count,
+                inlineValues.begin() + index
+            );
+        }
+        else {
+            spilledValues.erase(spilledValues.begin() + index);
+        }
+        letters &= ~(std::uint32_t(1) << letter);
+        return 1;
+    }
+    auto it = std::lower_bound(others.begin(), others.end(), key, keyLess);
+    if (it == others.end() || it->first != key) {
+        return 0;
+    }
+    others.erase(it);
+    return 1;
+}
+
+CommandParameters::const_iterator CommandParameters::find(const std::string& key) const
+{
+    // position both sequences at the first key not less than the given one
+    int letter = lettersCount;
+    if (key.empty() || key[0] < 'A') {
+        letter = 0;
+    }
+    else if (key[0] <= 'Z') {
+        letter = key[0] - 'A' + (key.size() > 1 ? 1 : 0);
+    }
+    auto side = std::lower_bound(others.begin(), others.end(), key, keyLess) - others.begin();
+
+    const_iterator it(this, letter, side);
+    return it != end() && it->first == key ? it : end();
+}
+
+CommandParameters::const_iterator CommandParameters::begin() const
+{
+    return {this, 0, 0};
+}
+
+CommandParameters::const_iterator CommandParameters::end() const
+{
+    return {this, lettersCount, others.size()};
+}
+
 // Constructors & destructors
 
 Command::Command(const char* name, const std::map<std::string, double>& parameters)
@@ -68,25 +323,16 @@ Command::~Command()
 
 Placement Command::getPlacement(const Base::Vector3d pos) const
 {
-    static const std::string x = "X";
-    static const std::string y = "Y";
-    static const std::string z = "Z";
-    static const std::string a = "A";
-    static const std::string b = "B";
-    static const std::string c = "C";
-    Vector3d vec(getParam(x, pos.x), getParam(y, pos.y), getParam(z, pos.z));
+    Vector3d vec(getParam('X', pos.x), getParam('Y', pos.y), getParam('Z', pos.z));
     Rotation rot;
-    rot.setYawPitchRoll(getParam(a), getParam(b), getParam(c));
+    rot.setYawPitchRoll(getParam('A'), getParam('B'), getParam('C'));
     Placement plac(vec, rot);
     return plac;
 }
 
 Vector3d Command::getCenter() const
 {
-    static const std::string i = "I";
-    static const std::string j = "J";
-    static const std::string k = "K";
-    Vector3d vec(getParam(i), getParam(j), getParam(k));
+    Vector3d vec(getParam('I'), getParam('J'), getParam('K'));
     return vec;
 }
 
@@ -106,30 +352,50 @@ bool Command::has(const std::string& attr) const
 
 std::string Command::toGCode(int precision, bool padzero) const
 {
-    std::stringstream str;
-    str.fill('0');
-    str << Name;
+    std::string str;
+    appendGCode(str, precision, padzero);
+    return str;
+}
+
+namespace
+{
+// appends the decimal representation of a non-negative value, padded with zeros to width
+void appendInteger(std::string& str, std::int64_t value, int width = 0)
+{
+    std::array<char, 24> buffer;
+    auto result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+    auto length = static_cast<int>(result.ptr - buffer.data());
+    if (length < width) {
+        str.append(width - length, '0');
+    }
+    str.append(buffer.data(), result.ptr);
+}
+}  // namespace
+
+void Command::appendGCode(std::string& str, int precision, bool padzero) const
+{
+    str += Name;
     if (precision < 0) {
         precision = 0;
     }
     double scale = std::pow(10.0, precision + 1);
     std::int64_t iscale = static_cast<std::int64_t>(scale) / 10;
-    for (std::map<std::string, double>::const_iterator i = Parameters.begin(); i != Parameters.end();
-         ++i) {
-        if (i->first == "N") {
+    for (const auto& [key, value] : Parameters) {
+        if (key == "N") {
             continue;
         }
 
-        str << " " << i->first;
+        str += ' ';
+        str += key;
 
-        std::int64_t v = static_cast<std::int64_t>(i->second * scale);
+        std::int64_t v = static_cast<std::int64_t>(value * scale);
         if (v < 0) {
             v = -v;
-            str << '-';  // shall we allow -0 ?
+            str += '-';  // shall we allow -0 ?
         }
         v += 5;
         v /= 10;
-        str << (v / iscale);
+        appendInteger(str, v / iscale);
         if (!precision) {
             continue;
         }
@@ -145,31 +411,33 @@ std::string Command::toGCode(int precision, bool padzero) const
                 --width;
             }
         }
-        str << '.' << std::setw(width) << std::right << digits;
+        str += '.';
+        appendInteger(str, digits, width);
     }
 
     // Add annotations as a comment if they exist
     if (!Annotations.empty()) {
-        str << "; ";
+        str += "; ";
         bool first = true;
         for (const auto& pair : Annotations) {
             if (!first) {
-                str << " ";
+                str += ' ';
             }
             first = false;
-            str << pair.first << ":";
+            str += pair.first;
+            str += ':';
             if (std::holds_alternative<std::string>(pair.second)) {
-                str << "'" << std::get<std::string>(pair.second) << "'";
+                str += '\'';
+                str += std::get<std::string>(pair.second);
+                str += '\'';
             }
             else if (std::holds_alternative<double>(pair.second)) {
                 std::ostringstream oss;
                 oss << std::fixed << std::setprecision(6) << std::get<double>(pair.second);
-                str << oss.str();
+                str += oss.str();
             }
         }
     }
-
-    return str.str();
 }
 
 void Command::setFromGCode(const std::string& str)
@@ -273,34 +541,28 @@ void Command::setFromPlacement(const Base::Placement& plac)
 {
     Name = "G1";
     Parameters.clear();
-    static const std::string x = "X";
-    static const std::string y = "Y";
-    static const std::string z = "Z";
-    static const std::string a = "A";
-    static const std::string b = "B";
-    static const std::string c = "C";
     double xval, yval, zval, aval, bval, cval;
     xval = plac.getPosition().x;
     yval = plac.getPosition().y;
     zval = plac.getPosition().z;
     plac.getRotation().getYawPitchRoll(aval, bval, cval);
     if (xval != 0.0) {
-        Parameters[x] = xval;
+        Parameters['X'] = xval;
     }
     if (yval != 0.0) {
-        Parameters[y] = yval;
+        Parameters['Y'] = yval;
     }
     if (zval != 0.0) {
-        Parameters[z] = zval;
+        Parameters['Z'] = zval;
     }
     if (aval != 0.0) {
-        Parameters[a] = aval;
+        Parameters['A'] = aval;
     }
     if (bval != 0.0) {
-        Parameters[b] = bval;
+        Parameters['B'] = bval;
     }
     if (cval != 0.0) {
-        Parameters[c] = cval;
+        Parameters['C'] = cval;
     }
 }
 
@@ -312,16 +574,13 @@ void Command::setCenter(const Base::Vector3d& pos, bool clockwise)
     else {
         Name = "G3";
     }
-    static const std::string i = "I";
-    static const std::string j = "J";
-    static const std::string k = "K";
     double ival, jval, kval;
     ival = pos.x;
     jval = pos.y;
     kval = pos.z;
-    Parameters[i] = ival;
-    Parameters[j] = jval;
-    Parameters[k] = kval;
+    Parameters['I'] = ival;
+    Parameters['J'] = jval;
+    Parameters['K'] = kval;
 }
 
 Command Command::transform(const Base::Placement& other)
@@ -335,8 +594,7 @@ Command Command::transform(const Base::Placement& other)
     plac.getRotation().getYawPitchRoll(aval, bval, cval);
     Command c = Command();
     c.Name = Name;
-    for (std::map<std::string, double>::const_iterator i = Parameters.begin(); i != Parameters.end();
-         ++i) {
+    for (auto i = Parameters.begin(); i != Parameters.end(); ++i) {
         std::string k = i->first;
         double v = i->second;
         if (k == "X") {
@@ -365,8 +623,7 @@ Command Command::transform(const Base::Placement& other)
 
 void Command::scaleBy(double factor)
 {
-    for (std::map<std::string, double>::const_iterator i = Parameters.begin(); i != Parameters.end();
-         ++i) {
+    for (auto i = Parameters.begin(); i != Parameters.end(); ++i) {
         switch (i->first[0]) {
             case 'X':
             case 'Y':
@@ -24,9 +24,13 @@
 
 #pragma once
 
+#include <array>
+#include <cstdint>
+#include <iterator>
 #include <map>
 #include <string>
 #include <variant>
+#include <vector>
 #include <Base/Persistence.h>
 #include <Base/Placement.h>
 #include <Base/Vector3D.h>
@@ -34,6 +38,92 @@
 
 namespace Path
 {
+/** The parameters of a cnc command, keyed by their upper case letter
+ *
+ * Toolpaths hold millions of commands, so the parameters avoid any heap allocation in the common
+ * case: a bitmask tells which of the letters A to Z are present and their values are packed in
+ * letter order into an inline buffer, which only spills to the heap for commands with more than
+ * inlineCapacity letters. Keys that are not a single upper case letter are kept in a sorted side
+ * list. The keys are iterated in the same order as in a std::map.
+ */
+class PathExport CommandParameters
+{
+public:
+    using value_type = std::pair<std::string, double>;
+
+    class PathExport const_iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = CommandParameters::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const value_type*;
+        using reference = const value_type&;
+
+        const_iterator() = default;
+
+        reference operator*() const
+        {
+            return current;
+        }
+        pointer operator->() const
+        {
+            return &current;
+        }
+        const_iterator& operator++();
+        const_iterator operator++(int);
+        bool operator==(const const_iterator& other) const
+        {
+            return letter == other.letter && side == other.side;
+        }
+
+    private:
+        friend class CommandParameters;
+        const_iterator(const CommandParameters* params, int letter, std::size_t side);
+        void update();
+
+        const CommandParameters* params = nullptr;
+        int letter = 0;          // next present letter, 26 at the end
+        std::size_t side = 0;    // next entry of the side list
+        value_type current;
+    };
+    using iterator = const_iterator;
+
+    CommandParameters() = default;
+    CommandParameters(const std::map<std::string, double>& parameters);
+
+    bool empty() const;
+    std::size_t size() const;
+    void clear();
+
+    bool contains(char key) const;
+    bool contains(const std::string& key) const;
+    double get(char key, double fallback = 0.0) const;
+    double get(const std::string& key, double fallback = 0.0) const;
+    double& operator[](char key);
+    double& operator[](const std::string& key);
+    std::size_t erase(const std::string& key);
+
+    const_iterator find(const std::string& key) const;
+    const_iterator begin() const;
+    const_iterator end() const;
+
+    static constexpr int inlineCapacity = 8;
+
+private:
+    // the slot of a key, or -1 if the key is not a single upper case letter
+    static int letterIndex(const std::string& key);
+    // the position of the value of a present letter in the packed values
+    int valueIndex(int letter) const;
+    double* values();
+    const double* values() const;
+
+    std::uint32_t letters = 0;  // bit i is set if the letter 'A' + i is present
+    std::array<double, inlineCapacity> inlineValues {};
+    std::vector<double> spilledValues;  // all the letter values once there are too many
+    std::vector<value_type> others;     // sorted by key
+};
+
 /** The representation of a cnc command in a path */
 class PathExport Command: public Base::Persistence
 {
@@ -67,11 +157,21 @@ public:
         int precision = 6,
         bool padzero = true
     ) const;                                // returns a GCode string representation of the command
+    void appendGCode(
+        std::string& str,
+        int precision = 6,
+        bool padzero = true
+    ) const;                                // appends the GCode representation to the given string
     void setFromGCode(const std::string&);  // sets the parameters from the contents of the given
                                             // GCode string
     void setFromPlacement(const Base::Placement&);  // sets the parameters from the contents of the
                                                     // given placement
     bool has(const std::string&) const;  // returns true if the given string exists in the parameters
+    // returns true if the given upper case letter exists in the parameters
+    bool has(char letter) const
+    {
+        return Parameters.contains(letter);
+    }
     Command transform(const Base::Placement&);       // returns a transformed copy of this command
     double getValue(const std::string& name) const;  // returns the value of a given parameter
     void scaleBy(double factor);  // scales the receiver - use for imperial/metric conversions
@@ -99,13 +199,16 @@ public:
     // this assumes the name is upper case
     inline double getParam(const std::string& name, double fallback = 0.0) const
     {
-        auto it = Parameters.find(name);
-        return it == Parameters.end() ? fallback : it->second;
+        return Parameters.get(name, fallback);
+    }
+    inline double getParam(char letter, double fallback = 0.0) const
+    {
+        return Parameters.get(letter, fallback);
     }
 
     // attributes
     std::string Name;
-    std::map<std::string, double> Parameters;
+    CommandParameters Parameters;
     std::map<std::string, std::variant<std::string, double>> Annotations;
 };
 
@@ -43,9 +43,7 @@ std::string CommandPy::representation() const
     str << "Command ";
     str << getCommandPtr()->Name;
     str << " [";
-    for (std::map<std::string, double>::iterator i = getCommandPtr()->Parameters.begin();
-         i != getCommandPtr()->Parameters.end();
-         ++i) {
+    for (auto i = getCommandPtr()->Parameters.begin(); i != getCommandPtr()->Parameters.end(); ++i) {
         std::string k = i->first;
         double v = i->second;
         str << " " << k << ":" << v;
@@ -213,8 +211,7 @@ Py::Dict CommandPy::getParameters() const
 {
     // dict now a class member , https://forum.freecad.org/viewtopic.php?f=15&t=50583
     if (parameters_copy_dict.length() == 0) {
-        for (std::map<std::string, double>::iterator i = getCommandPtr()->Parameters.begin();
-             i != getCommandPtr()->Parameters.end();
+        for (auto i = getCommandPtr()->Parameters.begin(); i != getCommandPtr()->Parameters.end();
              ++i) {
             parameters_copy_dict.setItem(i->first, Py::Float(i->second));
         }
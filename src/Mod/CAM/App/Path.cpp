@@ -29,7 +29,9 @@
 #include <Base/Writer.h>
 #include <Mod/CAM/App/PathSegmentWalker.h>
 
+#include <future>
 #include <numbers>
+#include <thread>
 
 #include "Path.h"
 
@@ -98,6 +100,83 @@ double getArcLength(
 
     return angle * radius;
 }
+
+// Smaller ranges of commands are not worth the threads
+constexpr std::size_t minChunkSize = 4096;
+
+std::size_t hardwareThreads()
+{
+    return std::max(1U, std::thread::hardware_concurrency());
+}
+
+// Splits [begin, end) into at most one chunk per hardware thread and calls
+// task(chunk, chunkBegin, chunkEnd) for the chunks concurrently
+template<typename Task>
+void forEachChunk(std::size_t begin, std::size_t end, const Task& task)
+{
+    std::size_t count = end - begin;
+    std::size_t chunks = std::max<std::size_t>(1, std::min(hardwareThreads(), count / minChunkSize));
+
+    std::vector<std::future<void>> futures;
+    for (std::size_t i = 1; i < chunks; i++) {
+        std::size_t chunkBegin = begin + i * count / chunks;
+        std::size_t chunkEnd = begin + (i + 1) * count / chunks;
+        futures.push_back(std::async(std::launch::async, [&task, i, chunkBegin, chunkEnd]() {
+            task(i, chunkBegin, chunkEnd);
+        }));
+    }
+    task(0, begin, begin + count / chunks);
+    // rethrows the exception of the first failed chunk
+    for (auto& future : futures) {
+        future.get();
+    }
+}
+
+// Formats the commands in batches, each one formatted in parallel chunks, and passes the text of
+// every chunk in order to write. Only one batch of text is held in memory at a time.
+template<typename Write>
+void formatGCode(const std::vector<Command>& commands, int precision, bool padzero, const Write& write)
+{
+    std::size_t threads = hardwareThreads();
+    std::size_t batchSize = threads * minChunkSize * 4;
+    std::vector<std::string> texts(threads);
+    for (std::size_t begin = 0; begin < commands.size(); begin += batchSize) {
+        std::size_t end = std::min(commands.size(), begin + batchSize);
+        forEachChunk(begin, end, [&](std::size_t chunk, std::size_t chunkBegin, std::size_t chunkEnd) {
+            std::string& text = texts[chunk];
+            text.clear();
+            for (std::size_t i = chunkBegin; i < chunkEnd; i++) {
+                commands[i].appendGCode(text, precision, padzero);
+                text += '\n';
+            }
+        });
+        for (auto& text : texts) {
+            if (!text.empty()) {
+                write(text);
+                text.clear();
+            }
+        }
+    }
+}
+
+// Parses the GCode strings into commands, in parallel chunks
+template<typename GetString>
+void parseGCode(std::size_t count, std::vector<Command>& commands, const GetString& getString)
+{
+    std::size_t offset = commands.size();
+    commands.resize(offset + count);
+    try {
+        forEachChunk(0, count, [&](std::size_t, std::size_t chunkBegin, std::size_t chunkEnd) {
+            for (std::size_t i = chunkBegin; i < chunkEnd; i++) {
+                commands[offset + i].setFromGCode(getString(i));
+            }
+        });
+    }
+    catch (...) {
+        commands.resize(offset);
+        throw;
+    }
+}
 }  // namespace
 
 Toolpath::Toolpath()
@@ -375,24 +454,6 @@ Base::BoundBox3d Toolpath::getBoundBox() const
     return visitor.bb;
 }
 
-static void bulkAddCommand(const std::string& gcodestr, std::vector<Command>& commands, bool& inches)
-{
-    Command cmd;
-    cmd.setFromGCode(gcodestr);
-    if ("G20" == cmd.Name) {
-        inches = true;
-    }
-    else if ("G21" == cmd.Name) {
-        inches = false;
-    }
-    else {
-        if (inches) {
-            cmd.scaleBy(25.4);
-        }
-        commands.push_back(cmd);
-    }
-}
-
 void Toolpath::setFromGCode(const std::string instr)
 {
     clear();
@@ -400,20 +461,19 @@ void Toolpath::setFromGCode(const std::string instr)
     // remove comments
     // boost::regex e("\\(.*?\\)");
     // std::string str = boost::regex_replace(instr, e, "");
-    std::string str(instr);
+    const std::string& str(instr);
 
     // split input string by () or G or M commands
+    std::vector<std::pair<std::size_t, std::size_t>> gcodestrs;  // position and length
     std::string mode = "command";
     std::size_t found = str.find_first_of("(gGmM");
     int last = -1;
-    bool inches = false;
     while (found != std::string::npos) {
         if (str[found] == '(') {
             // start of comment
             if ((last > -1) && (mode == "command")) {
                 // before opening a comment, add the last found command
-                std::string gcodestr = str.substr(last, found - last);
-                bulkAddCommand(gcodestr, vpcCommands, inches);
+                gcodestrs.emplace_back(last, found - last);
             }
             mode = "comment";
             last = found;
@@ -421,8 +481,7 @@ void Toolpath::setFromGCode(const std::string instr)
         }
         else if (str[found] == ')') {
             // end of comment
-            std::string gcodestr = str.substr(last, found - last + 1);
-            bulkAddCommand(gcodestr, vpcCommands, inches);
+            gcodestrs.emplace_back(last, found - last + 1);
             last = -1;
             found = str.find_first_of("(gGmM", found + 1);
             mode = "command";
@@ -430,8 +489,7 @@ void Toolpath::setFromGCode(const std::string instr)
         else if (mode == "command") {
             // command
             if (last > -1) {
-                std::string gcodestr = str.substr(last, found - last);
-                bulkAddCommand(gcodestr, vpcCommands, inches);
+                gcodestrs.emplace_back(last, found - last);
             }
             last = found;
             found = str.find_first_of("(gGmM", found + 1);
@@ -440,8 +498,30 @@ void Toolpath::setFromGCode(const std::string instr)
     // add the last command found, if any
     if (last > -1) {
         if (mode == "command") {
-            std::string gcodestr = str.substr(last, std::string::npos);
-            bulkAddCommand(gcodestr, vpcCommands, inches);
+            gcodestrs.emplace_back(last, str.size() - last);
+        }
+    }
+
+    std::vector<Command> commands;
+    parseGCode(gcodestrs.size(), commands, [&](std::size_t i) {
+        return str.substr(gcodestrs[i].first, gcodestrs[i].second);
+    });
+
+    // the units apply to the commands following them, so they are handled in order
+    bool inches = false;
+    vpcCommands.reserve(commands.size());
+    for (auto& cmd : commands) {
+        if ("G20" == cmd.Name) {
+            inches = true;
+        }
+        else if ("G21" == cmd.Name) {
+            inches = false;
+        }
+        else {
+            if (inches) {
+                cmd.scaleBy(25.4);
+            }
+            vpcCommands.push_back(std::move(cmd));
         }
     }
     recalculate();
@@ -450,13 +530,17 @@ void Toolpath::setFromGCode(const std::string instr)
 std::string Toolpath::toGCode() const
 {
     std::string result;
-    for (const auto& command : vpcCommands) {
-        result += command.toGCode();
-        result += "\n";
-    }
+    formatGCode(vpcCommands, 6, true, [&result](const std::string& text) { result += text; });
     return result;
 }
 
+void Toolpath::toGCode(std::ostream& out, int precision, bool padzero) const
+{
+    formatGCode(vpcCommands, precision, padzero, [&out](const std::string& text) {
+        out.write(text.data(), static_cast<std::streamsize>(text.size()));
+    });
+}
+
 void Toolpath::recalculate()  // recalculates the path cache
 {
 
@@ -565,10 +649,7 @@ void Toolpath::Save(Writer& writer) const
 
 void Toolpath::SaveDocFile(Base::Writer& writer) const
 {
-    if (toGCode().empty()) {
-        return;
-    }
-    writer.Stream() << toGCode();
+    toGCode(writer.Stream());
 }
 
 void Toolpath::Restore(XMLReader& reader)
@@ -604,13 +685,26 @@ void Toolpath::addCommandNoRecalc(const Command& Cmd)
 
 void Toolpath::RestoreDocFile(Base::Reader& reader)
 {
+    // the lines are read in batches, each one parsed in parallel chunks
+    std::size_t batchSize = hardwareThreads() * minChunkSize * 4;
+    std::vector<std::string> lines;
+    lines.reserve(batchSize);
+    auto parseLines = [this, &lines]() {
+        parseGCode(lines.size(), vpcCommands, [&lines](std::size_t i) -> const std::string& {
+            return lines[i];
+        });
+        lines.clear();
+    };
+
     std::string line;
     while (std::getline(reader.getStream(), line)) {
         if (!line.empty()) {
-            Command cmd;
-            cmd.setFromGCode(line);
-            addCommandNoRecalc(cmd);
+            lines.push_back(std::move(line));
+            if (lines.size() == batchSize) {
+                parseLines();
+            }
         }
     }
+    parseLines();
     recalculate();  // Only once, after all commands are loaded
 }
@@ -23,6 +23,7 @@
 
 #pragma once
 
+#include <iosfwd>
 #include <Base/BoundBox.h>
 #include <Base/Persistence.h>
 #include <Base/Vector3D.h>
@@ -64,6 +65,11 @@ public:
     void recalculate();                                   // recalculates the points
     void setFromGCode(const std::string);  // sets the path from the contents of the given GCode string
     std::string toGCode() const;           // gets a gcode string representation from the Path
+    void toGCode(
+        std::ostream& out,
+        int precision = 6,
+        bool padzero = true
+    ) const;  // writes the gcode representation of the Path to the given stream
     Base::BoundBox3d getBoundBox() const;
 
     // shortcut functions
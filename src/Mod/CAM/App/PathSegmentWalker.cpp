@@ -172,23 +172,23 @@ void PathSegmentWalker::walk(PathSegmentVisitor& cb, const Base::Vector3d& start
         if (!absolute) {
             next = last + next;
         }
-        if (!cmd.has("X")) {
+        if (!cmd.has('X')) {
             next.x = last.x;
         }
-        if (!cmd.has("Y")) {
+        if (!cmd.has('Y')) {
             next.y = last.y;
         }
-        if (!cmd.has("Z")) {
+        if (!cmd.has('Z')) {
             next.z = last.z;
         }
-        if (cmd.has("A")) {
-            a = cmd.getValue("A");
+        if (cmd.has('A')) {
+            a = cmd.getParam('A');
         }
-        if (cmd.has("B")) {
-            b = cmd.getValue("B");
+        if (cmd.has('B')) {
+            b = cmd.getParam('B');
         }
-        if (cmd.has("C")) {
-            c = cmd.getValue("C");
+        if (cmd.has('C')) {
+            c = cmd.getParam('C');
         }
 
         Base::Rotation nrot = yawPitchRoll(a, b, c);
@@ -343,8 +343,8 @@ void PathSegmentWalker::walk(PathSegmentVisitor& cb, const Base::Vector3d& start
             }
 
             double r = 0;
-            if (cmd.has("R")) {
-                r = cmd.getValue("R");
+            if (cmd.has('R')) {
+                r = cmd.getParam('R');
             }
 
             std::deque<Base::Vector3d> plist;
@@ -380,8 +380,8 @@ void PathSegmentWalker::walk(PathSegmentVisitor& cb, const Base::Vector3d& start
             Base::Vector3d p2r = compensateRotation(p2, nrot, rotCenter);
 
             double q;
-            if (cmd.has("Q")) {
-                q = cmd.getValue("Q");
+            if (cmd.has('Q')) {
+                q = cmd.getParam('Q');
                 if (q > 0) {
                     Base::Vector3d temp(next);
                     for (temp.*pz = r; temp.*pz > next.*pz; temp.*pz -= q) {
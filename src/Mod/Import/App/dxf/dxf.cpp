@@ -7,12 +7,15 @@
 
 
 #include <cmath>
+#include <cstdlib>
+#include <cstring>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
 #include <exception>
 #include <string>
+#include <type_traits>
 
 #include "dxf.h"
 #include <App/Application.h>
@@ -1954,45 +1957,30 @@ void CDxfRead::SetupValueAttribute(eDXFGroupCode_t record_type, T& destination)
 // Static processing helpers for ProcessCommonEntityAttribute
 void CDxfRead::ProcessScaledDouble(CDxfRead* object, void* target)
 {
-    std::istringstream ss;
-    ss.imbue(std::locale("C"));
-
-    ss.str(object->m_record_data);
     double value = 0;
-    ss >> value;
-    if (ss.fail()) {
-        object->ImportError(
-            "Unable to parse value '%s', using zero as its value\n",
-            object->m_record_data
-        );
-    }
+    ParseValue<double>(object, &value);
     *static_cast<double*>(target) = object->mm(value);
 }
 void CDxfRead::ProcessScaledDoubleIntoList(CDxfRead* object, void* target)
 {
-    std::istringstream ss;
-    ss.imbue(std::locale("C"));
-
-    ss.str(object->m_record_data);
     double value = 0;
-    ss >> value;
-    if (ss.fail()) {
-        object->ImportError(
-            "Unable to parse value '%s', using zero as its value\n",
-            object->m_record_data
-        );
-    }
+    ParseValue<double>(object, &value);
     static_cast<std::list<double>*>(target)->push_back(object->mm(value));
 }
 template<typename T>
 bool CDxfRead::ParseValue(CDxfRead* object, void* target)
 {
-    std::istringstream ss;
-    ss.imbue(std::locale("C"));
-
-    ss.str(object->m_record_data);
-    ss >> *static_cast<T*>(target);
-    if (ss.fail()) {
+    // Constructing a stream for each value dominates the reading time of large files, so the
+    // C library is used instead. The numeric locale of FreeCAD is always "C".
+    const char* start = object->m_record_data.c_str();
+    char* end = nullptr;
+    if constexpr (std::is_floating_point_v<T>) {
+        *static_cast<T*>(target) = static_cast<T>(std::strtod(start, &end));
+    }
+    else {
+        *static_cast<T*>(target) = static_cast<T>(std::strtol(start, &end, 10));
+    }
+    if (end == start) {
         object->ImportError(
             "Unable to parse value '%s', using zero as its value\n",
             object->m_record_data
@@ -2471,12 +2459,10 @@ bool CDxfRead::get_next_record()
     }
 
     do {
-        if ((*m_ifs).eof()) {
+        if (!get_next_line(m_record_data)) {
             m_not_eof = false;
             return false;
         }
-
-        std::getline(*m_ifs, m_record_data);
         ++m_line;
         int temp = 0;
         if (!ParseValue<int>(this, &temp)) {
@@ -2487,11 +2473,9 @@ bool CDxfRead::get_next_record()
             return false;
         }
         m_record_type = (eDXFGroupCode_t)temp;
-        if ((*m_ifs).eof()) {
+        if (!get_next_line(m_record_data)) {
             return false;
         }
-
-        std::getline(*m_ifs, m_record_data);
         ++m_line;
     } while (m_record_type == eComment);
 
@@ -2513,6 +2497,55 @@ void CDxfRead::repeat_last_record()
     m_repeat_last_record = true;
 }
 
+bool CDxfRead::get_next_line(std::string& line)
+{
+    for (;;) {
+        const char* start = m_buffer.data() + m_buffer_start;
+        const char* end = m_buffer.data() + m_buffer_end;
+        auto newline = start == end
+            ? nullptr
+            : static_cast<const char*>(std::memchr(start, '\n', end - start));
+        if (newline != nullptr) {
+            // assign() reuses the capacity of line, so no allocation happens per record
+            line.assign(start, newline);
+            m_buffer_start = newline + 1 - m_buffer.data();
+            return true;
+        }
+        if (m_stream_exhausted) {
+            if (start == end) {
+                return false;
+            }
+            // the last line has no line terminator
+            line.assign(start, end);
+            m_buffer_start = m_buffer_end;
+            return true;
+        }
+        fill_buffer();
+    }
+}
+
+void CDxfRead::fill_buffer()
+{
+    // keep the incomplete line at the end of the buffer
+    size_t remaining = m_buffer_end - m_buffer_start;
+    if (remaining > 0 && m_buffer_start > 0) {
+        std::memmove(m_buffer.data(), m_buffer.data() + m_buffer_start, remaining);
+    }
+    m_buffer_start = 0;
+    m_buffer_end = remaining;
+
+    const size_t blockSize = 1 << 20;
+    if (m_buffer.size() < m_buffer_end + blockSize) {
+        m_buffer.resize(m_buffer_end + blockSize);
+    }
+
+    m_ifs->read(m_buffer.data() + m_buffer_end, static_cast<std::streamsize>(blockSize));
+    m_buffer_end += static_cast<size_t>(m_ifs->gcount());
+    if (!(*m_ifs)) {
+        m_stream_exhausted = true;
+    }
+}
+
 //
 //  Intercepts for On... calls to derived class
 //  (These have distinct signatures from the ones they call)
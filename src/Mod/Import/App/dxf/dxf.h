@@ -487,6 +487,12 @@ class ImportExport CDxfRead
 private:
     // Low-level reader members
     std::ifstream* m_ifs;  // TODO: gsl::owner<ifstream>
+    // The file is read in large blocks and split into lines in place, which is much
+    // faster than reading it line by line from the stream.
+    std::vector<char> m_buffer;
+    size_t m_buffer_start = 0;
+    size_t m_buffer_end = 0;
+    bool m_stream_exhausted = false;
     // https://stackoverflow.com/questions/41167119/how-to-fix-a-wsubobject-linkage-warning
     eDXFGroupCode_t m_record_type = eObjectType;
     std::string m_record_data;
@@ -724,6 +730,8 @@ private:
 
     bool get_next_record();
     void repeat_last_record();
+    bool get_next_line(std::string& line);
+    void fill_buffer();
 
     bool (CDxfRead::*stringToUTF8)(std::string&) const = &CDxfRead::UTF8ToUTF8;
 
@@ -24,6 +24,12 @@
 
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <set>
+#include <thread>
 #include <vector>
 
 
@@ -42,6 +48,41 @@
 using namespace MeshCore;
 
 
+bool MeshEvaluationPipeline::Evaluate()
+{
+    // the first evaluation runs in this thread, the futures of std::async wait for
+    // their threads on destruction if an evaluation throws an exception
+    std::vector<std::future<bool>> futures;
+    for (std::size_t i = 1; i < _evaluations.size(); i++) {
+        futures.push_back(std::async(std::launch::async, [eval = _evaluations[i].get()]() {
+            return eval->Evaluate();
+        }));
+    }
+
+    _results.clear();
+    if (!_evaluations.empty()) {
+        _results.push_back(_evaluations.front()->Evaluate());
+    }
+    for (auto& future : futures) {
+        _results.push_back(future.get());
+    }
+
+    return std::find(_results.begin(), _results.end(), false) == _results.end();
+}
+
+bool MeshEvaluationPipeline::IsValid(const MeshEvaluation& eval) const
+{
+    for (std::size_t i = 0; i < _results.size(); i++) {
+        if (_evaluations[i].get() == &eval) {
+            return _results[i];
+        }
+    }
+
+    return true;
+}
+
+// ----------------------------------------------------
+
 MeshOrientationVisitor::MeshOrientationVisitor() = default;
 
 bool MeshOrientationVisitor::Visit(
@@ -600,81 +641,31 @@ bool MeshFixSingleFacet::Fixup()
 
 // ----------------------------------------------------------------
 
-bool MeshEvalSelfIntersection::Evaluate()
+namespace
 {
-    // Contains bounding boxes for every facet
-    std::vector<Base::BoundBox3f> boxes;
-
-    // Splits the mesh using grid for speeding up the calculation
-    MeshFacetGrid cMeshFacetGrid(_rclMesh);
-    const MeshFacetArray& rFaces = _rclMesh.GetFacets();
-    MeshGridIterator clGridIter(cMeshFacetGrid);
-    unsigned long ulGridX {}, ulGridY {}, ulGridZ {};
-    cMeshFacetGrid.GetCtGrids(ulGridX, ulGridY, ulGridZ);
-
-    MeshFacetIterator cMFI(_rclMesh);
-    for (cMFI.Begin(); cMFI.More(); cMFI.Next()) {
-        boxes.push_back((*cMFI).GetBoundBox());
-    }
-
-    // Calculates the intersections
-    Base::SequencerLauncher seq("Checking for self-intersections...", ulGridX * ulGridY * ulGridZ);
-    for (clGridIter.Init(); clGridIter.More(); clGridIter.Next()) {
-        // Get the facet indices, belonging to the current grid unit
-        std::vector<FacetIndex> aulGridElements;
-        clGridIter.GetElements(aulGridElements);
-
-        seq.next();
-        if (aulGridElements.empty()) {
-            continue;
-        }
-
-        MeshGeomFacet facet1, facet2;
-        Base::Vector3f pt1, pt2;
-        for (auto it = aulGridElements.begin(); it != aulGridElements.end(); ++it) {
-            const Base::BoundBox3f& box1 = boxes[*it];
-            cMFI.Set(*it);
-            facet1 = *cMFI;
-            const MeshFacet& rface1 = rFaces[*it];
-            for (auto jt = it; jt != aulGridElements.end(); ++jt) {
-                if (jt == it) {  // the identical facet
-                    continue;
-                }
-                // If the facets share a common vertex we do not check for self-intersections
-                // because they could but usually do not intersect each other and the algorithm
-                // below would detect false-positives, otherwise
-                const MeshFacet& rface2 = rFaces[*jt];
-                if (rface1._aulPoints[0] == rface2._aulPoints[0]
-                    || rface1._aulPoints[0] == rface2._aulPoints[1]
-                    || rface1._aulPoints[0] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
-                }
-                if (rface1._aulPoints[1] == rface2._aulPoints[0]
-                    || rface1._aulPoints[1] == rface2._aulPoints[1]
-                    || rface1._aulPoints[1] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
-                }
-                if (rface1._aulPoints[2] == rface2._aulPoints[0]
-                    || rface1._aulPoints[2] == rface2._aulPoints[1]
-                    || rface1._aulPoints[2] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
-                }
-
-                const Base::BoundBox3f& box2 = boxes[*jt];
-                if (box1 && box2) {
-                    cMFI.Set(*jt);
-                    facet2 = *cMFI;
-                    int ret = facet1.IntersectWithFacet(facet2, pt1, pt2);
-                    if (ret == 2) {
-                        // abort after the first detected self-intersection
-                        return false;
-                    }
-                }
+// Facets that share a common vertex are not checked for self-intersections because they
+// could but usually do not intersect each other and the intersection test would detect
+// false-positives, otherwise
+bool shareCommonVertex(const MeshFacet& rface1, const MeshFacet& rface2)
+{
+    for (PointIndex index1 : rface1._aulPoints) {
+        for (PointIndex index2 : rface2._aulPoints) {
+            if (index1 == index2) {
+                return true;
             }
         }
     }
 
-    return true;
+    return false;
+}
+}  // namespace
+
+bool MeshEvalSelfIntersection::Evaluate()
+{
+    std::vector<std::pair<FacetIndex, FacetIndex>> intersection;
+    // abort after the first detected self-intersection
+    FindIntersections(intersection, true);
+    return intersection.empty();
 }
 
 void MeshEvalSelfIntersection::GetIntersections(
@@ -707,76 +698,133 @@ void MeshEvalSelfIntersection::GetIntersections(
     std::vector<std::pair<FacetIndex, FacetIndex>>& intersection
 ) const
 {
-    // Contains bounding boxes for every facet
-    std::vector<Base::BoundBox3f> boxes;
-    // intersection.clear();
+    FindIntersections(intersection, false);
+}
 
+void MeshEvalSelfIntersection::FindIntersections(
+    std::vector<std::pair<FacetIndex, FacetIndex>>& intersection,
+    bool firstOnly
+) const
+{
     // Splits the mesh using grid for speeding up the calculation
     MeshFacetGrid cMeshFacetGrid(_rclMesh);
     const MeshFacetArray& rFaces = _rclMesh.GetFacets();
-    MeshGridIterator clGridIter(cMeshFacetGrid);
-    unsigned long ulGridX {}, ulGridY {}, ulGridZ {};
-    cMeshFacetGrid.GetCtGrids(ulGridX, ulGridY, ulGridZ);
+    const MeshPointArray& rPoints = _rclMesh.GetPoints();
 
-    MeshFacetIterator cMFI(_rclMesh);
-    for (cMFI.Begin(); cMFI.More(); cMFI.Next()) {
-        boxes.push_back((*cMFI).GetBoundBox());
-    }
+    // Contains bounding boxes for every facet
+    std::vector<Base::BoundBox3f> boxes(rFaces.size());
+    parallel_chunks(boxes.size(), 100000, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t index = begin; index < end; index++) {
+            for (PointIndex point : rFaces[index]._aulPoints) {
+                boxes[index].Add(rPoints[point]);
+            }
+        }
+    });
 
-    // Calculates the intersections
-    Base::SequencerLauncher seq("Checking for self-intersections...", ulGridX * ulGridY * ulGridZ);
+    // Only grid elements with at least two facets need to be checked
+    std::vector<std::array<unsigned long, 3>> cells;
+    MeshGridIterator clGridIter(cMeshFacetGrid);
     for (clGridIter.Init(); clGridIter.More(); clGridIter.Next()) {
-        // Get the facet indices, belonging to the current grid unit
-        std::vector<FacetIndex> aulGridElements;
-        clGridIter.GetElements(aulGridElements);
-
-        seq.next(true);
-        if (aulGridElements.empty()) {
-            continue;
+        if (clGridIter.GetCtElements() > 1) {
+            std::array<unsigned long, 3> pos {};
+            clGridIter.GetGridPos(pos[0], pos[1], pos[2]);
+            cells.push_back(pos);
         }
+    }
 
-        MeshGeomFacet facet1, facet2;
-        Base::Vector3f pt1, pt2;
-        for (auto it = aulGridElements.begin(); it != aulGridElements.end(); ++it) {
-            const Base::BoundBox3f& box1 = boxes[*it];
-            cMFI.Set(*it);
-            facet1 = *cMFI;
-            const MeshFacet& rface1 = rFaces[*it];
-            for (auto jt = it; jt != aulGridElements.end(); ++jt) {
-                if (jt == it) {  // the identical facet
-                    continue;
-                }
-                // If the facets share a common vertex we do not check for self-intersections
-                // because they could but usually do not intersect each other and the algorithm
-                // below would detect false-positives, otherwise
-                const MeshFacet& rface2 = rFaces[*jt];
-                if (rface1._aulPoints[0] == rface2._aulPoints[0]
-                    || rface1._aulPoints[0] == rface2._aulPoints[1]
-                    || rface1._aulPoints[0] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
-                }
-                if (rface1._aulPoints[1] == rface2._aulPoints[0]
-                    || rface1._aulPoints[1] == rface2._aulPoints[1]
-                    || rface1._aulPoints[1] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
-                }
-                if (rface1._aulPoints[2] == rface2._aulPoints[0]
-                    || rface1._aulPoints[2] == rface2._aulPoints[1]
-                    || rface1._aulPoints[2] == rface2._aulPoints[2]) {
-                    continue;  // ignore facets sharing a common vertex
-                }
+    // The grid elements are handled in blocks by several threads. Every block has its own
+    // result buffer so that the result is in the same order as for a sequential run.
+    constexpr std::size_t blockSize = 64;
+    std::size_t numBlocks = (cells.size() + blockSize - 1) / blockSize;
+    std::vector<std::vector<std::pair<FacetIndex, FacetIndex>>> results(numBlocks);
+    std::atomic<std::size_t> nextBlock {0};
+    std::atomic<std::size_t> doneBlocks {0};
+    std::atomic<bool> stop {false};
+
+    auto checkBlock = [&](std::size_t block) {
+        std::set<FacetIndex> elements;
+        std::size_t end = std::min(cells.size(), (block + 1) * blockSize);
+        for (std::size_t cell = block * blockSize; cell < end && !stop; cell++) {
+            // Get the facet indices, belonging to the current grid unit
+            elements.clear();
+            cMeshFacetGrid.GetElements(cells[cell][0], cells[cell][1], cells[cell][2], elements);
+
+            Base::Vector3f pt1, pt2;
+            for (auto it = elements.begin(); it != elements.end(); ++it) {
+                const Base::BoundBox3f& box1 = boxes[*it];
+                const MeshFacet& rface1 = rFaces[*it];
+                MeshGeomFacet facet1 = _rclMesh.GetFacet(rface1);
+                for (auto jt = std::next(it); jt != elements.end(); ++jt) {
+                    const MeshFacet& rface2 = rFaces[*jt];
+                    if (shareCommonVertex(rface1, rface2)) {
+                        continue;  // ignore facets sharing a common vertex
+                    }
 
-                const Base::BoundBox3f& box2 = boxes[*jt];
-                if (box1 && box2) {
-                    cMFI.Set(*jt);
-                    facet2 = *cMFI;
-                    int ret = facet1.IntersectWithFacet(facet2, pt1, pt2);
-                    if (ret == 2) {
-                        intersection.emplace_back(*it, *jt);
+                    const Base::BoundBox3f& box2 = boxes[*jt];
+                    if (box1 && box2) {
+                        MeshGeomFacet facet2 = _rclMesh.GetFacet(rface2);
+                        int ret = facet1.IntersectWithFacet(facet2, pt1, pt2);
+                        if (ret == 2) {
+                            results[block].emplace_back(*it, *jt);
+                            if (firstOnly) {
+                                stop = true;
+                                return;
+                            }
+                        }
                     }
                 }
             }
         }
+    };
+
+    auto checkBlocks = [&]() {
+        std::size_t block {};
+        while (!stop && (block = nextBlock++) < numBlocks) {
+            checkBlock(block);
+            doneBlocks++;
+        }
+    };
+
+    std::size_t numThreads = std::max(1U, std::thread::hardware_concurrency());
+    numThreads = std::min(numThreads, numBlocks);
+
+    std::vector<std::future<void>> futures;
+    for (std::size_t i = 1; i < numThreads; i++) {
+        futures.push_back(std::async(std::launch::async, checkBlocks));
+    }
+
+    // Calculates the intersections, the progress is reported by this thread only
+    Base::SequencerLauncher seq("Checking for self-intersections...", numBlocks);
+    try {
+        std::size_t reported = 0;
+        auto report = [&]() {
+            for (std::size_t done = doneBlocks; reported < done; reported++) {
+                seq.next(!firstOnly);
+            }
+        };
+        std::size_t block {};
+        while (!stop && (block = nextBlock++) < numBlocks) {
+            checkBlock(block);
+            doneBlocks++;
+            report();
+        }
+        for (auto& future : futures) {
+            while (future.wait_for(std::chrono::milliseconds(100)) != std::future_status::ready) {
+                report();
+            }
+        }
+    }
+    catch (...) {
+        stop = true;
+        throw;
+    }
+
+    for (auto& future : futures) {
+        future.get();
+    }
+
+    for (const auto& result : results) {
+        intersection.insert(intersection.end(), result.begin(), result.end());
     }
 }
 
@@ -26,6 +26,8 @@
 
 #include <cmath>
 #include <list>
+#include <memory>
+#include <vector>
 
 #include "MeshKernel.h"
 #include "Visitor.h"
@@ -103,6 +105,58 @@ protected:
 
 // ----------------------------------------------------
 
+/**
+ * The MeshEvaluationPipeline class runs several evaluations of the same mesh kernel
+ * concurrently, each in its own thread, and collects their results.
+ * Only evaluations that don't depend on each other and don't modify the flags of the
+ * mesh kernel may be added.
+ * \code
+ * MeshEvaluationPipeline pipeline(kernel);
+ * auto& topology = pipeline.Add<MeshEvalTopology>();
+ * auto& folds = pipeline.Add<MeshEvalFoldsOnSurface>();
+ * if (!pipeline.Evaluate()) {
+ *     if (!pipeline.IsValid(topology)) {
+ *         ...
+ *     }
+ * }
+ * \endcode
+ */
+class MeshExport MeshEvaluationPipeline
+{
+public:
+    explicit MeshEvaluationPipeline(const MeshKernel& rclB)
+        : _rclMesh(rclB)
+    {}
+
+    /**
+     * Creates an evaluation of type \a T for the mesh kernel and adds it to the pipeline.
+     * The pipeline owns the evaluation. The returned reference can be used to access the
+     * details of the result after Evaluate() has been called.
+     */
+    template<class T, class... Args>
+    T& Add(Args&&... args)
+    {
+        auto eval = std::make_unique<T>(_rclMesh, std::forward<Args>(args)...);
+        T& ref = *eval;
+        _evaluations.push_back(std::move(eval));
+        return ref;
+    }
+    /**
+     * Runs all evaluations and returns true if the mesh kernel is valid with respect
+     * to all of them.
+     */
+    bool Evaluate();
+    /** Returns the result of the given evaluation of the last call of Evaluate(). */
+    bool IsValid(const MeshEvaluation&) const;
+
+private:
+    const MeshKernel& _rclMesh;
+    std::vector<std::unique_ptr<MeshEvaluation>> _evaluations;
+    std::vector<bool> _results;
+};
+
+// ----------------------------------------------------
+
 /**
  * This class searches for nonuniform orientation of neighboured facets.
  * @author Werner Mayer
@@ -339,6 +393,10 @@ public:
     ) const;
     /// collect the index of all facets with self intersections
     void GetIntersections(std::vector<std::pair<FacetIndex, FacetIndex>>&) const;
+
+private:
+    /// Checks the facets of the grid elements concurrently
+    void FindIntersections(std::vector<std::pair<FacetIndex, FacetIndex>>&, bool firstOnly) const;
 };
 
 /**
@@ -26,6 +26,9 @@
 
 #include <algorithm>
 #include <future>
+#include <thread>
+#include <type_traits>
+#include <vector>
 
 
 namespace MeshCore
@@ -61,4 +64,41 @@ static void parallel_sort(Iter begin, Iter end, Pred comp, int threads)
     }
 }
 
+/** Splits the index range [0, size) into contiguous chunks of at least \a minChunkSize
+ * elements, one per hardware thread at most, and calls \a func(begin, end) for each chunk
+ * concurrently. If \a func returns a value the results are returned in the order of the chunks.
+ */
+template<class Func>
+static auto parallel_chunks(std::size_t size, std::size_t minChunkSize, Func func)
+{
+    using Result = std::invoke_result_t<Func, std::size_t, std::size_t>;
+
+    std::size_t chunks = std::max(1U, std::thread::hardware_concurrency());
+    chunks = std::max<std::size_t>(1, std::min(chunks, size / std::max<std::size_t>(1, minChunkSize)));
+
+    std::vector<std::future<Result>> futures;
+    futures.reserve(chunks - 1);
+    for (std::size_t i = 1; i < chunks; i++) {
+        futures.push_back(
+            std::async(std::launch::async, func, i * size / chunks, (i + 1) * size / chunks)
+        );
+    }
+
+    if constexpr (std::is_void_v<Result>) {
+        func(std::size_t(0), size / chunks);
+        for (auto& future : futures) {
+            future.get();
+        }
+    }
+    else {
+        std::vector<Result> results;
+        results.reserve(chunks);
+        results.push_back(func(std::size_t(0), size / chunks));
+        for (auto& future : futures) {
+            results.push_back(future.get());
+        }
+        return results;
+    }
+}
+
 }  // namespace MeshCore
@@ -24,10 +24,16 @@
 
 
 #include <algorithm>
+#include <cctype>
 #include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <future>
 #include <iomanip>
+#include <limits>
 #include <sstream>
 #include <string_view>
+#include <thread>
 
 
 #include <boost/algorithm/string.hpp>
@@ -140,6 +146,104 @@ private:
     Base::ifstream str;
 };
 
+static bool isBlank(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+/* Collects the points of all lines of the form 'vertex x y z' (case-insensitive) in the text
+ * [begin, end). The text must be followed by a line break or a terminating zero.
+ */
+static void parseAsciiSTLVertices(const char* begin, const char* end, std::vector<Base::Vector3f>& points)
+{
+    constexpr std::string_view keyword = "VERTEX";
+    auto matchKeyword = [keyword](const char* pos) {
+        return std::equal(keyword.begin(), keyword.end(), pos, [](char k, char c) {
+            return k == std::toupper(static_cast<unsigned char>(c));
+        });
+    };
+
+    for (const char* line = begin; line < end;) {
+        const char* eol = static_cast<const char*>(std::memchr(line, '\n', end - line));
+        if (!eol) {
+            eol = end;
+        }
+
+        const char* pos = line;
+        while (pos < eol && isBlank(*pos)) {
+            ++pos;
+        }
+
+        std::size_t length = eol - pos;
+        if (length > keyword.size() && matchKeyword(pos) && isBlank(pos[keyword.size()])) {
+            pos += keyword.size();
+            float coords[3];
+            bool ok = true;
+            for (float& coord : coords) {
+                char* next = nullptr;
+                coord = std::strtof(pos, &next);
+                // strtof() skips leading blanks but must not continue on the next line
+                if (next == pos || next > eol || (next < eol && !isBlank(*next))) {
+                    ok = false;
+                    break;
+                }
+                pos = next;
+            }
+            while (ok && pos < eol && isBlank(*pos)) {
+                ++pos;
+            }
+            if (ok && pos == eol) {
+                points.emplace_back(coords[0], coords[1], coords[2]);
+            }
+        }
+
+        line = eol + 1;
+    }
+}
+
+/* Parses the vertices of the ASCII STL text in \a text concurrently. The text is split into
+ * chunks at line breaks and the points are returned in the order of the text.
+ */
+static std::vector<Base::Vector3f> parseAsciiSTLVertices(const std::string& text)
+{
+    // Smaller texts are not worth the threads
+    constexpr std::size_t minChunkSize = 1024 * 1024;
+
+    std::size_t threads = std::max(1U, std::thread::hardware_concurrency());
+    threads = std::max<std::size_t>(1, std::min(threads, text.size() / minChunkSize));
+
+    std::vector<const char*> bounds {text.data()};
+    for (std::size_t i = 1; i < threads; i++) {
+        std::size_t pos = text.find('\n', i * text.size() / threads);
+        if (pos == std::string::npos) {
+            break;
+        }
+        const char* bound = text.data() + pos + 1;
+        if (bound > bounds.back()) {
+            bounds.push_back(bound);
+        }
+    }
+    bounds.push_back(text.data() + text.size());
+
+    std::vector<std::vector<Base::Vector3f>> chunks(bounds.size() - 1);
+    std::vector<std::future<void>> futures;
+    for (std::size_t i = 1; i < chunks.size(); i++) {
+        futures.push_back(std::async(std::launch::async, [&, i]() {
+            parseAsciiSTLVertices(bounds[i], bounds[i + 1], chunks[i]);
+        }));
+    }
+    parseAsciiSTLVertices(bounds[0], bounds[1], chunks[0]);
+    for (auto& future : futures) {
+        future.get();
+    }
+
+    std::vector<Base::Vector3f> points = std::move(chunks[0]);
+    for (std::size_t i = 1; i < chunks.size(); i++) {
+        points.insert(points.end(), chunks[i].begin(), chunks[i].end());
+    }
+    return points;
+}
+
 }  // namespace MeshCore
 
 // --------------------------------------------------------------
@@ -728,22 +832,10 @@ bool MeshInput::LoadMeshNode(std::istream& input)
 /** Loads an ASCII STL file. */
 bool MeshInput::LoadAsciiSTL(std::istream& input)
 {
-    boost::regex rx_p(
-        "^\\s*VERTEX\\s+([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)"
-        "\\s+([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)"
-        "\\s+([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)\\s*$"
-    );
-    boost::regex rx_f(
-        "^\\s*FACET\\s+NORMAL\\s+([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)"
-        "\\s+([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)"
-        "\\s+([-+]?[0-9]*)\\.?([0-9]+([eE][-+]?[0-9]+)?)\\s*$"
-    );
-    boost::cmatch what;
-
-    std::string line;
-    float fX {}, fY {}, fZ {};
-    unsigned long ulVertexCt {}, ulFacetCt {};
-    MeshGeomFacet clFacet;
+    // The file is read in blocks of this size which are parsed concurrently
+    constexpr std::size_t blockSize = 64 * 1024 * 1024;
+    // Rough size of the text of a facet, used to reserve memory
+    constexpr std::streamoff facetSize = 200;
 
     if (!input || input.bad()) {
         return false;
@@ -753,50 +845,38 @@ bool MeshInput::LoadAsciiSTL(std::istream& input)
     std::streambuf* buf = input.rdbuf();
     ulSize = buf->pubseekoff(0, std::ios::end, std::ios::in);
     buf->pubseekoff(0, std::ios::beg, std::ios::in);
-    ulSize -= 20;
 
-    // count facets
-    while (std::getline(input, line)) {
-        boost::algorithm::to_upper(line);
-        if (line.find("ENDFACET") != std::string::npos) {
-            ulFacetCt++;
-        }
-        // prevent from reading EOF (as I don't know how to reread the file then)
-        if (input.tellg() > ulSize) {
-            break;
-        }
-        if (line.find("ENDSOLID") != std::string::npos) {
-            break;
-        }
-    }
-
-    // restart from the beginning
-    buf->pubseekoff(0, std::ios::beg, std::ios::in);
-
-#if 0
-    MeshBuilder builder(this->_rclMesh);
-#else
     MeshFastBuilder builder(this->_rclMesh);
-#endif
-    builder.Initialize(ulFacetCt);
-
-    ulVertexCt = 0;
-    while (std::getline(input, line)) {
-        boost::algorithm::to_upper(line);
-        if (boost::regex_match(line.c_str(), what, rx_f)) {
-            fX = (float)std::atof(what[1].first);
-            fY = (float)std::atof(what[4].first);
-            fZ = (float)std::atof(what[7].first);
-            clFacet.SetNormal(Base::Vector3f(fX, fY, fZ));
-        }
-        else if (boost::regex_match(line.c_str(), what, rx_p)) {
-            fX = (float)std::atof(what[1].first);
-            fY = (float)std::atof(what[4].first);
-            fZ = (float)std::atof(what[7].first);
-            clFacet._aclPoints[ulVertexCt++].Set(fX, fY, fZ);
+    builder.Initialize(static_cast<MeshFastBuilder::size_type>(
+        std::min<std::streamoff>(ulSize / facetSize, std::numeric_limits<int>::max() / 3)
+    ));
+
+    // The facet normals are not needed because the builder doesn't use them
+    std::string block;
+    std::string rest;
+    Base::Vector3f facet[3];
+    int ulVertexCt = 0;
+    while (input) {
+        block.swap(rest);
+        std::size_t offset = block.size();
+        block.resize(offset + blockSize);
+        input.read(block.data() + offset, blockSize);
+        block.resize(offset + static_cast<std::size_t>(input.gcount()));
+
+        // keep an incomplete last line for the next block
+        rest.clear();
+        if (input) {
+            std::size_t pos = block.rfind('\n');
+            pos = (pos == std::string::npos) ? 0 : pos + 1;
+            rest.assign(block, pos);
+            block.resize(pos);
+        }
+
+        for (const auto& point : parseAsciiSTLVertices(block)) {
+            facet[ulVertexCt++] = point;
             if (ulVertexCt == 3) {
                 ulVertexCt = 0;
-                builder.AddFacet(clFacet);
+                builder.AddFacet(facet);
             }
         }
     }
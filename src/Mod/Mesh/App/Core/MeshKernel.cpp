@@ -29,6 +29,7 @@
 #include <map>
 #include <queue>
 #include <stdexcept>
+#include <vector>
 
 
 #include <Base/Exception.h>
@@ -38,6 +39,7 @@
 #include "Algorithm.h"
 #include "Builder.h"
 #include "Evaluation.h"
+#include "Functional.h"
 #include "Iterator.h"
 #include "MeshIO.h"
 #include "MeshKernel.h"
@@ -46,6 +48,55 @@
 
 using namespace MeshCore;
 
+namespace
+{
+// Number of points or facets that are converted at once when reading or
+// writing a mesh. Transferring whole blocks avoids a stream call per value.
+constexpr std::size_t ioBlockSize = 65536;
+
+// Minimum number of points or facets per thread for the bulk operations on the whole mesh.
+// Below this size the overhead of the threads outweighs the gain.
+constexpr std::size_t minChunkSize = 100000;
+
+inline Base::Vector3f facetNormal(const MeshPointArray& points, const MeshFacet& face)
+{
+    const Base::Vector3f& p1 = points[face._aulPoints[0]];
+    const Base::Vector3f& p2 = points[face._aulPoints[1]];
+    const Base::Vector3f& p3 = points[face._aulPoints[2]];
+    return (p2 - p1) % (p3 - p1);
+}
+
+inline double facetArea(const MeshPointArray& points, const MeshFacet& face)
+{
+    return 0.5 * static_cast<double>(facetNormal(points, face).Length());
+}
+
+template<typename T>
+void writeBlock(std::ostream& out, std::vector<T>& block, bool swap)
+{
+    if (swap) {
+        for (auto& value : block) {
+            Base::SwapEndian(value);
+        }
+    }
+    out.write(reinterpret_cast<const char*>(block.data()), std::streamsize(block.size() * sizeof(T)));
+}
+
+template<typename T>
+void readBlock(std::istream& in, std::vector<T>& block, bool swap)
+{
+    in.read(reinterpret_cast<char*>(block.data()), std::streamsize(block.size() * sizeof(T)));
+    if (!in) {
+        throw Base::BadFormatError("Reading from stream failed");
+    }
+    if (swap) {
+        for (auto& value : block) {
+            Base::SwapEndian(value);
+        }
+    }
+}
+}  // namespace
+
 MeshKernel::MeshKernel()
 {
     _clBoundBox.SetVoid();
@@ -913,16 +964,35 @@ void MeshKernel::Write(std::ostream& rclOut) const
     str << static_cast<uint32_t>(CountPoints()) << static_cast<uint32_t>(CountFacets());
 
     // write the data
-    for (const auto& it : _aclPointArray) {
-        str << it.x << it.y << it.z;
-    }
-
-    for (const auto& it : _aclFacetArray) {
-        str << static_cast<uint32_t>(it._aulPoints[0]) << static_cast<uint32_t>(it._aulPoints[1])
-            << static_cast<uint32_t>(it._aulPoints[2]);
-        str << static_cast<uint32_t>(it._aulNeighbours[0])
-            << static_cast<uint32_t>(it._aulNeighbours[1])
-            << static_cast<uint32_t>(it._aulNeighbours[2]);
+    bool swap = str.byteOrder() == Base::Stream::BigEndian;
+    std::vector<float> coords;
+    for (std::size_t first = 0; first < _aclPointArray.size(); first += ioBlockSize) {
+        std::size_t last = std::min(first + ioBlockSize, _aclPointArray.size());
+        coords.clear();
+        for (std::size_t i = first; i < last; i++) {
+            const MeshPoint& pnt = _aclPointArray[i];
+            coords.insert(coords.end(), {pnt.x, pnt.y, pnt.z});
+        }
+        writeBlock(rclOut, coords, swap);
+    }
+
+    std::vector<uint32_t> indices;
+    for (std::size_t first = 0; first < _aclFacetArray.size(); first += ioBlockSize) {
+        std::size_t last = std::min(first + ioBlockSize, _aclFacetArray.size());
+        indices.clear();
+        for (std::size_t i = first; i < last; i++) {
+            const MeshFacet& face = _aclFacetArray[i];
+            indices.insert(
+                indices.end(),
+                {static_cast<uint32_t>(face._aulPoints[0]),
+                 static_cast<uint32_t>(face._aulPoints[1]),
+                 static_cast<uint32_t>(face._aulPoints[2]),
+                 static_cast<uint32_t>(face._aulNeighbours[0]),
+                 static_cast<uint32_t>(face._aulNeighbours[1]),
+                 static_cast<uint32_t>(face._aulNeighbours[2])}
+            );
+        }
+        writeBlock(rclOut, indices, swap);
     }
 
     str << _clBoundBox.MinX << _clBoundBox.MaxX;
@@ -968,18 +1038,37 @@ void MeshKernel::Read(std::istream& rclIn)
 
         try {
             // read the data
+            bool swap = str.byteOrder() == Base::Stream::BigEndian;
             MeshPointArray pointArray;
             pointArray.resize(uCtPts);
-            for (auto& it : pointArray) {
-                str >> it.x >> it.y >> it.z;
+
+            std::vector<float> coords;
+            for (std::size_t first = 0; first < pointArray.size(); first += ioBlockSize) {
+                std::size_t last = std::min(first + ioBlockSize, pointArray.size());
+                coords.resize(3 * (last - first));
+                readBlock(rclIn, coords, swap);
+                auto coord = coords.begin();
+                for (std::size_t i = first; i < last; i++, coord += 3) {
+                    pointArray[i].Set(coord[0], coord[1], coord[2]);
+                }
             }
 
             MeshFacetArray facetArray;
             facetArray.resize(uCtFts);
 
+            std::vector<uint32_t> indices;
             uint32_t v1 {}, v2 {}, v3 {};
-            for (auto& it : facetArray) {
-                str >> v1 >> v2 >> v3;
+            for (std::size_t index = 0; index < facetArray.size(); index++) {
+                auto& it = facetArray[index];
+                std::size_t offset = 6 * (index % ioBlockSize);
+                if (offset == 0) {
+                    std::size_t count = std::min(ioBlockSize, facetArray.size() - index);
+                    indices.resize(6 * count);
+                    readBlock(rclIn, indices, swap);
+                }
+                v1 = indices[offset];
+                v2 = indices[offset + 1];
+                v3 = indices[offset + 2];
 
                 // make sure to have valid indices
                 if (v1 >= uCtPts || v2 >= uCtPts || v3 >= uCtPts) {
@@ -994,7 +1083,9 @@ void MeshKernel::Read(std::istream& rclIn)
                 // the empty neighbour must be explicitly set to 'FACET_INDEX_MAX'
                 // because in algorithms this value is always used to check
                 // for open edges.
-                str >> v1 >> v2 >> v3;
+                v1 = indices[offset + 3];
+                v2 = indices[offset + 4];
+                v3 = indices[offset + 5];
 
                 // make sure to have valid indices
                 if (v1 >= uCtFts && v1 < open_edge) {
@@ -1126,13 +1217,19 @@ void MeshKernel::operator*=(const Base::Matrix4D& rclMat)
 
 void MeshKernel::Transform(const Base::Matrix4D& rclMat)
 {
-    auto clPIter = _aclPointArray.begin(), clPEIter = _aclPointArray.end();
+    MeshPointArray& points = _aclPointArray;
+    auto boxes = parallel_chunks(points.size(), minChunkSize, [&](std::size_t begin, std::size_t end) {
+        Base::BoundBox3f box;
+        for (std::size_t index = begin; index < end; index++) {
+            points[index] *= rclMat;
+            box.Add(points[index]);
+        }
+        return box;
+    });
 
     _clBoundBox.SetVoid();
-    while (clPIter < clPEIter) {
-        *clPIter *= rclMat;
-        _clBoundBox.Add(*clPIter);
-        clPIter++;
+    for (const auto& box : boxes) {
+        _clBoundBox.Add(box);
     }
 }
 
@@ -1144,27 +1241,41 @@ void MeshKernel::Smooth(int iterations, float stepsize)
 
 void MeshKernel::RecalcBoundBox() const
 {
+    const MeshPointArray& points = _aclPointArray;
+    auto boxes = parallel_chunks(points.size(), minChunkSize, [&](std::size_t begin, std::size_t end) {
+        Base::BoundBox3f box;
+        for (std::size_t index = begin; index < end; index++) {
+            box.Add(points[index]);
+        }
+        return box;
+    });
+
     _clBoundBox.SetVoid();
-    for (const auto& pI : _aclPointArray) {
-        _clBoundBox.Add(pI);
+    for (const auto& box : boxes) {
+        _clBoundBox.Add(box);
     }
 }
 
 std::vector<Base::Vector3f> MeshKernel::CalcVertexNormals() const
 {
+    // the facet normals are computed concurrently but summed up in the order of the
+    // facets so that the result doesn't depend on the number of threads
+    std::vector<Base::Vector3f> facetNormals(CountFacets());
+    parallel_chunks(facetNormals.size(), minChunkSize, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t index = begin; index < end; index++) {
+            facetNormals[index] = facetNormal(_aclPointArray, _aclFacetArray[index]);
+        }
+    });
+
     std::vector<Base::Vector3f> normals;
 
     normals.resize(CountPoints());
 
-    PointIndex p1 {}, p2 {}, p3 {};
-    unsigned int ct = CountFacets();
-    for (unsigned int pFIter = 0; pFIter < ct; pFIter++) {
-        GetFacetPoints(pFIter, p1, p2, p3);
-        Base::Vector3f Norm = (GetPoint(p2) - GetPoint(p1)) % (GetPoint(p3) - GetPoint(p1));
-
-        normals[p1] += Norm;
-        normals[p2] += Norm;
-        normals[p3] += Norm;
+    for (std::size_t index = 0; index < facetNormals.size(); index++) {
+        const MeshFacet& face = _aclFacetArray[index];
+        for (PointIndex point : face._aulPoints) {
+            normals[point] += facetNormals[index];
+        }
     }
 
     return normals;
@@ -1172,20 +1283,14 @@ std::vector<Base::Vector3f> MeshKernel::CalcVertexNormals() const
 
 std::vector<Base::Vector3f> MeshKernel::GetFacetNormals(const std::vector<FacetIndex>& facets) const
 {
-    std::vector<Base::Vector3f> normals;
-    normals.reserve(facets.size());
-
-    for (FacetIndex it : facets) {
-        const MeshFacet& face = _aclFacetArray[it];
-
-        const Base::Vector3f& p1 = _aclPointArray[face._aulPoints[0]];
-        const Base::Vector3f& p2 = _aclPointArray[face._aulPoints[1]];
-        const Base::Vector3f& p3 = _aclPointArray[face._aulPoints[2]];
-
-        Base::Vector3f n = (p2 - p1) % (p3 - p1);
-        n.Normalize();
-        normals.emplace_back(n);
-    }
+    std::vector<Base::Vector3f> normals(facets.size());
+    parallel_chunks(facets.size(), minChunkSize, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t index = begin; index < end; index++) {
+            Base::Vector3f n = facetNormal(_aclPointArray, _aclFacetArray[facets[index]]);
+            n.Normalize();
+            normals[index] = n;
+        }
+    });
 
     return normals;
 }
@@ -1193,26 +1298,38 @@ std::vector<Base::Vector3f> MeshKernel::GetFacetNormals(const std::vector<FacetI
 // Evaluation
 float MeshKernel::GetSurface() const
 {
-    float fSurface = 0.0;
-    MeshFacetIterator cIter(*this);
-    for (cIter.Init(); cIter.More(); cIter.Next()) {
-        fSurface += cIter->Area();
+    auto areas = parallel_chunks(CountFacets(), minChunkSize, [this](std::size_t begin, std::size_t end) {
+        double area = 0.0;
+        for (std::size_t index = begin; index < end; index++) {
+            area += facetArea(_aclPointArray, _aclFacetArray[index]);
+        }
+        return area;
+    });
+
+    double fSurface = 0.0;
+    for (double area : areas) {
+        fSurface += area;
     }
 
-    return fSurface;
+    return static_cast<float>(fSurface);
 }
 
 float MeshKernel::GetSurface(const std::vector<FacetIndex>& aSegment) const
 {
-    float fSurface = 0.0;
-    MeshFacetIterator cIter(*this);
+    auto areas = parallel_chunks(aSegment.size(), minChunkSize, [&](std::size_t begin, std::size_t end) {
+        double area = 0.0;
+        for (std::size_t index = begin; index < end; index++) {
+            area += facetArea(_aclPointArray, _aclFacetArray[aSegment[index]]);
+        }
+        return area;
+    });
 
-    for (FacetIndex it : aSegment) {
-        cIter.Set(it);
-        fSurface += cIter->Area();
+    double fSurface = 0.0;
+    for (double area : areas) {
+        fSurface += area;
     }
 
-    return fSurface;
+    return static_cast<float>(fSurface);
 }
 
 float MeshKernel::GetVolume() const
@@ -1221,24 +1338,29 @@ float MeshKernel::GetVolume() const
     // if ( !cSolid.Evaluate() )
     //     return 0.0f; // no solid
 
-    float fVolume = 0.0;
-    MeshFacetIterator cIter(*this);
-    Base::Vector3f p1, p2, p3;
-    for (cIter.Init(); cIter.More(); cIter.Next()) {
-        const MeshGeomFacet& rclF = *cIter;
-        p1 = rclF._aclPoints[0];
-        p2 = rclF._aclPoints[1];
-        p3 = rclF._aclPoints[2];
+    auto volumes = parallel_chunks(CountFacets(), minChunkSize, [this](std::size_t begin, std::size_t end) {
+        double volume = 0.0;
+        for (std::size_t index = begin; index < end; index++) {
+            const MeshFacet& face = _aclFacetArray[index];
+            const Base::Vector3f& p1 = _aclPointArray[face._aulPoints[0]];
+            const Base::Vector3f& p2 = _aclPointArray[face._aulPoints[1]];
+            const Base::Vector3f& p3 = _aclPointArray[face._aulPoints[2]];
+
+            volume
+                += (-p3.x * p2.y * p1.z + p2.x * p3.y * p1.z + p3.x * p1.y * p2.z
+                    - p1.x * p3.y * p2.z - p2.x * p1.y * p3.z + p1.x * p2.y * p3.z);
+        }
+        return volume;
+    });
 
-        fVolume
-            += (-p3.x * p2.y * p1.z + p2.x * p3.y * p1.z + p3.x * p1.y * p2.z - p1.x * p3.y * p2.z
-                - p2.x * p1.y * p3.z + p1.x * p2.y * p3.z);
+    double fVolume = 0.0;
+    for (double volume : volumes) {
+        fVolume += volume;
     }
 
-    fVolume /= 6.0F;
-    fVolume = std::fabs(fVolume);
+    fVolume /= 6.0;
 
-    return fVolume;
+    return static_cast<float>(std::fabs(fVolume));
 }
 
 bool MeshKernel::HasOpenEdges() const
@@ -931,6 +931,22 @@ void PropertyMeshKernel::RestoreDocFile(Base::Reader& reader)
     hasSetValue();
 }
 
+bool PropertyMeshKernel::canDecodeDocFile() const
+{
+    return true;
+}
+
+std::function<void()> PropertyMeshKernel::decodeDocFile(Base::Reader& reader)
+{
+    Base::Reference<MeshObject> mesh(new MeshObject());
+    mesh->load(reader);
+    return [this, mesh]() {
+        aboutToSetValue();
+        _meshObject->swap(mesh->getKernel());
+        hasSetValue();
+    };
+}
+
 App::Property* PropertyMeshKernel::Copy() const
 {
     // Note: Copy the content, do NOT reference the same mesh object
@@ -316,6 +316,8 @@ public:
 
     void SaveDocFile(Base::Writer& writer) const override;
     void RestoreDocFile(Base::Reader& reader) override;
+    bool canDecodeDocFile() const override;
+    std::function<void()> decodeDocFile(Base::Reader& reader) override;
 
     App::Property* Copy() const override;
     void Paste(const App::Property& from) override;
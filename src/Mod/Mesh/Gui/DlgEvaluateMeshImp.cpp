@@ -605,17 +605,19 @@ void DlgEvaluateMeshImp::onAnalyzeNonmanifoldsButtonClicked()
         qApp->setOverrideCursor(Qt::WaitCursor);
 
         const MeshKernel& rMesh = d->meshFeature->Mesh.getValue().getKernel();
-        MeshEvalTopology f_eval(rMesh);
-        bool ok1 = f_eval.Evaluate();
-        bool ok2 = true;
-        std::vector<Mesh::PointIndex> point_indices;
-
+        MeshEvaluationPipeline pipeline(rMesh);
+        auto& f_eval = pipeline.Add<MeshEvalTopology>();
+        MeshEvalPointManifolds* p_eval = nullptr;
         if (d->checkNonManfoldPoints) {
-            MeshEvalPointManifolds p_eval(rMesh);
-            ok2 = p_eval.Evaluate();
-            if (!ok2) {
-                point_indices = p_eval.GetIndices();
-            }
+            p_eval = &pipeline.Add<MeshEvalPointManifolds>();
+        }
+
+        pipeline.Evaluate();
+        bool ok1 = pipeline.IsValid(f_eval);
+        bool ok2 = !p_eval || pipeline.IsValid(*p_eval);
+        std::vector<Mesh::PointIndex> point_indices;
+        if (!ok2) {
+            point_indices = p_eval->GetIndices();
         }
 
         if (ok1 && ok2) {
@@ -1105,14 +1107,12 @@ void DlgEvaluateMeshImp::onAnalyzeFoldsButtonClicked()
         qApp->setOverrideCursor(Qt::WaitCursor);
 
         const MeshKernel& rMesh = d->meshFeature->Mesh.getValue().getKernel();
-        MeshEvalFoldsOnSurface s_eval(rMesh);
-        MeshEvalFoldsOnBoundary b_eval(rMesh);
-        MeshEvalFoldOversOnSurface f_eval(rMesh);
-        bool ok1 = s_eval.Evaluate();
-        bool ok2 = b_eval.Evaluate();
-        bool ok3 = f_eval.Evaluate();
-
-        if (ok1 && ok2 && ok3) {
+        MeshEvaluationPipeline pipeline(rMesh);
+        auto& s_eval = pipeline.Add<MeshEvalFoldsOnSurface>();
+        auto& b_eval = pipeline.Add<MeshEvalFoldsOnBoundary>();
+        auto& f_eval = pipeline.Add<MeshEvalFoldOversOnSurface>();
+
+        if (pipeline.Evaluate()) {
             d->ui.checkFoldsButton->setText(tr("No folds on surface"));
             d->ui.checkFoldsButton->setChecked(false);
             d->ui.repairFoldsButton->setEnabled(false);
@@ -1216,10 +1216,11 @@ void DlgEvaluateMeshImp::onRepairAllTogetherClicked()
                     qApp->processEvents();
                 }
                 if (d->enableFoldsCheck) {
-                    MeshEvalFoldsOnSurface s_eval(rMesh);
-                    MeshEvalFoldsOnBoundary b_eval(rMesh);
-                    MeshEvalFoldOversOnSurface f_eval(rMesh);
-                    if (!s_eval.Evaluate() || !b_eval.Evaluate() || !f_eval.Evaluate()) {
+                    MeshEvaluationPipeline pipeline(rMesh);
+                    pipeline.Add<MeshEvalFoldsOnSurface>();
+                    pipeline.Add<MeshEvalFoldsOnBoundary>();
+                    pipeline.Add<MeshEvalFoldOversOnSurface>();
+                    if (!pipeline.Evaluate()) {
                         Gui::Command::doCommand(Gui::Command::App,
                             "App.getDocument(\"%s\").getObject(\"%s\").removeFoldsOnSurface()",
                             docName, objName);
@@ -26,6 +26,7 @@
 #include <Precision.hxx>
 
 
+#include <Base/Exception.h>
 #include <Base/Reader.h>
 
 #include "FeaturePartBox.h"
@@ -52,33 +53,41 @@ short Box::mustExecute() const
 }
 
 App::DocumentObjectExecReturn* Box::execute()
+{
+    try {
+        TopoDS_Shape ResultShape = takeShape();
+        this->Shape.setValue(ResultShape, false);
+        return Primitive::execute();
+    }
+    catch (const Base::ValueError& e) {
+        return new App::DocumentObjectExecReturn(e.what());
+    }
+    catch (Standard_Failure& e) {
+        return new App::DocumentObjectExecReturn(e.GetMessageString());
+    }
+}
+
+TopoDS_Shape Box::makeShape() const
 {
     double L = Length.getValue();
     double W = Width.getValue();
     double H = Height.getValue();
 
     if (L < Precision::Confusion()) {
-        return new App::DocumentObjectExecReturn("Length of box too small");
+        throw Base::ValueError("Length of box too small");
     }
 
     if (W < Precision::Confusion()) {
-        return new App::DocumentObjectExecReturn("Width of box too small");
+        throw Base::ValueError("Width of box too small");
     }
 
     if (H < Precision::Confusion()) {
-        return new App::DocumentObjectExecReturn("Height of box too small");
+        throw Base::ValueError("Height of box too small");
     }
 
-    try {
-        // Build a box using the dimension attributes
-        BRepPrimAPI_MakeBox mkBox(L, W, H);
-        TopoDS_Shape ResultShape = mkBox.Shape();
-        this->Shape.setValue(ResultShape, false);
-        return Primitive::execute();
-    }
-    catch (Standard_Failure& e) {
-        return new App::DocumentObjectExecReturn(e.GetMessageString());
-    }
+    // Build a box using the dimension attributes
+    BRepPrimAPI_MakeBox mkBox(L, W, H);
+    return mkBox.Shape();
 }
 
 /**
@@ -49,6 +49,10 @@ public:
     /// recalculate the Feature
     App::DocumentObjectExecReturn* execute() override;
     short mustExecute() const override;
+    bool canRecomputeConcurrently() const override
+    {
+        return true;
+    }
     /// returns the type name of the ViewProvider
     const char* getViewProviderName() const override
     {
@@ -60,6 +64,7 @@ protected:
     /// get called by the container when a property has changed
     void onChanged(const App::Property* prop) override;
     //@}
+    TopoDS_Shape makeShape() const override;
 };
 
 }  // namespace Part
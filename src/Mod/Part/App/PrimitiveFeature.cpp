@@ -23,6 +23,7 @@
  ***************************************************************************/
 
 #include <limits>
+#include <utility>
 
 #include <BRepBuilderAPI_GTransform.hxx>
 #include <BRepBuilderAPI_MakeEdge.hxx>
@@ -46,6 +47,7 @@
 #include <TopoDS_Vertex.hxx>
 
 #include <App/FeaturePythonPyImp.h>
+#include <Base/Exception.h>
 #include <Base/Reader.h>
 #include <Base/Tools.h>
 
@@ -85,6 +87,34 @@ App::DocumentObjectExecReturn* Primitive::execute()
     return Part::Feature::execute();
 }
 
+void Primitive::computeConcurrently()
+{
+    try {
+        computedShape = makeShape();
+    }
+    catch (...) {
+        computeError = std::current_exception();
+    }
+}
+
+TopoDS_Shape Primitive::makeShape() const
+{
+    return {};
+}
+
+TopoDS_Shape Primitive::takeShape()
+{
+    if (auto error = std::exchange(computeError, nullptr)) {
+        std::rethrow_exception(error);
+    }
+    if (computedShape) {
+        TopoDS_Shape shape = *computedShape;
+        computedShape.reset();
+        return shape;
+    }
+    return makeShape();
+}
+
 // suppress warning about tp_print for Py3.8
 #if defined(__clang__)
 # pragma clang diagnostic push
@@ -140,6 +170,16 @@ void Primitive::handleChangedPropertyType(
     }
 }
 
+void Primitive::onBeforeChange(const App::Property* prop)
+{
+    // a concurrently computed shape is outdated once an input changes
+    if (prop != &Shape) {
+        computedShape.reset();
+        computeError = nullptr;
+    }
+    Part::Feature::onBeforeChange(prop);
+}
+
 void Primitive::onChanged(const App::Property* prop)
 {
     if (!isRestoring()) {
@@ -363,20 +403,13 @@ short Sphere::mustExecute() const
 
 App::DocumentObjectExecReturn* Sphere::execute()
 {
-    // Build a sphere
-    if (Radius.getValue() < Precision::Confusion()) {
-        return new App::DocumentObjectExecReturn("Radius of sphere too small");
-    }
     try {
-        BRepPrimAPI_MakeSphere mkSphere(
-            Radius.getValue(),
-            Base::toRadians<double>(Angle1.getValue()),
-            Base::toRadians<double>(Angle2.getValue()),
-            Base::toRadians<double>(Angle3.getValue())
-        );
-        TopoDS_Shape ResultShape = mkSphere.Shape();
+        TopoDS_Shape ResultShape = takeShape();
         this->Shape.setValue(ResultShape);
     }
+    catch (const Base::ValueError& e) {
+        return new App::DocumentObjectExecReturn(e.what());
+    }
     catch (Standard_Failure& e) {
 
         return new App::DocumentObjectExecReturn(e.GetMessageString());
@@ -385,6 +418,21 @@ App::DocumentObjectExecReturn* Sphere::execute()
     return Primitive::execute();
 }
 
+TopoDS_Shape Sphere::makeShape() const
+{
+    // Build a sphere
+    if (Radius.getValue() < Precision::Confusion()) {
+        throw Base::ValueError("Radius of sphere too small");
+    }
+    BRepPrimAPI_MakeSphere mkSphere(
+        Radius.getValue(),
+        Base::toRadians<double>(Angle1.getValue()),
+        Base::toRadians<double>(Angle2.getValue()),
+        Base::toRadians<double>(Angle3.getValue())
+    );
+    return mkSphere.Shape();
+}
+
 PROPERTY_SOURCE(Part::Ellipsoid, Part::Primitive)
 
 Ellipsoid::Ellipsoid()
@@ -506,27 +554,13 @@ short Cylinder::mustExecute() const
 
 App::DocumentObjectExecReturn* Cylinder::execute()
 {
-    // Build a cylinder
-    if (Radius.getValue() < Precision::Confusion()) {
-        return new App::DocumentObjectExecReturn("Radius of cylinder too small");
-    }
-    if (Height.getValue() < Precision::Confusion()) {
-        return new App::DocumentObjectExecReturn("Height of cylinder too small");
-    }
-    if (Angle.getValue() < Precision::Confusion()) {
-        return new App::DocumentObjectExecReturn("Rotation angle of cylinder too small");
-    }
     try {
-        BRepPrimAPI_MakeCylinder mkCylr(
-            Radius.getValue(),
-            Height.getValue(),
-            Base::toRadians<double>(Angle.getValue())
-        );
-        // the direction vector for the prism is the height for z and the given angle
-        BRepPrim_Cylinder prim = mkCylr.Cylinder();
-        TopoDS_Shape ResultShape = makePrism(Height.getValue(), prim.BottomFace());
+        TopoDS_Shape ResultShape = takeShape();
         this->Shape.setValue(ResultShape);
     }
+    catch (const Base::ValueError& e) {
+        return new App::DocumentObjectExecReturn(e.what());
+    }
     catch (Standard_Failure& e) {
 
         return new App::DocumentObjectExecReturn(e.GetMessageString());
@@ -535,6 +569,28 @@ App::DocumentObjectExecReturn* Cylinder::execute()
     return Primitive::execute();
 }
 
+TopoDS_Shape Cylinder::makeShape() const
+{
+    // Build a cylinder
+    if (Radius.getValue() < Precision::Confusion()) {
+        throw Base::ValueError("Radius of cylinder too small");
+    }
+    if (Height.getValue() < Precision::Confusion()) {
+        throw Base::ValueError("Height of cylinder too small");
+    }
+    if (Angle.getValue() < Precision::Confusion()) {
+        throw Base::ValueError("Rotation angle of cylinder too small");
+    }
+    BRepPrimAPI_MakeCylinder mkCylr(
+        Radius.getValue(),
+        Height.getValue(),
+        Base::toRadians<double>(Angle.getValue())
+    );
+    // the direction vector for the prism is the height for z and the given angle
+    BRepPrim_Cylinder prim = mkCylr.Cylinder();
+    return makePrism(Height.getValue(), prim.BottomFace());
+}
+
 App::PropertyIntegerConstraint::Constraints Prism::polygonRange = {3, INT_MAX, 1};
 
 PROPERTY_SOURCE(Part::Prism, Part::Primitive)
@@ -715,38 +771,13 @@ short Cone::mustExecute() const
 
 App::DocumentObjectExecReturn* Cone::execute()
 {
-    if (Radius1.getValue() < 0) {
-        return new App::DocumentObjectExecReturn("Radius of cone too small");
-    }
-    if (Radius2.getValue() < 0) {
-        return new App::DocumentObjectExecReturn("Radius of cone too small");
-    }
-    if (Height.getValue() < Precision::Confusion()) {
-        return new App::DocumentObjectExecReturn("Height of cone too small");
-    }
     try {
-        TopoDS_Shape ResultShape;
-        if (std::abs(Radius1.getValue() - Radius2.getValue()) < Precision::Confusion()) {
-            // Build a cylinder
-            BRepPrimAPI_MakeCylinder mkCylr(
-                Radius1.getValue(),
-                Height.getValue(),
-                Base::toRadians<double>(Angle.getValue())
-            );
-            ResultShape = mkCylr.Shape();
-        }
-        else {
-            // Build a cone
-            BRepPrimAPI_MakeCone mkCone(
-                Radius1.getValue(),
-                Radius2.getValue(),
-                Height.getValue(),
-                Base::toRadians<double>(Angle.getValue())
-            );
-            ResultShape = mkCone.Shape();
-        }
+        TopoDS_Shape ResultShape = takeShape();
         this->Shape.setValue(ResultShape);
     }
+    catch (const Base::ValueError& e) {
+        return new App::DocumentObjectExecReturn(e.what());
+    }
     catch (Standard_Failure& e) {
 
         return new App::DocumentObjectExecReturn(e.GetMessageString());
@@ -755,6 +786,36 @@ App::DocumentObjectExecReturn* Cone::execute()
     return Primitive::execute();
 }
 
+TopoDS_Shape Cone::makeShape() const
+{
+    if (Radius1.getValue() < 0) {
+        throw Base::ValueError("Radius of cone too small");
+    }
+    if (Radius2.getValue() < 0) {
+        throw Base::ValueError("Radius of cone too small");
+    }
+    if (Height.getValue() < Precision::Confusion()) {
+        throw Base::ValueError("Height of cone too small");
+    }
+    if (std::abs(Radius1.getValue() - Radius2.getValue()) < Precision::Confusion()) {
+        // Build a cylinder
+        BRepPrimAPI_MakeCylinder mkCylr(
+            Radius1.getValue(),
+            Height.getValue(),
+            Base::toRadians<double>(Angle.getValue())
+        );
+        return mkCylr.Shape();
+    }
+    // Build a cone
+    BRepPrimAPI_MakeCone mkCone(
+        Radius1.getValue(),
+        Radius2.getValue(),
+        Height.getValue(),
+        Base::toRadians<double>(Angle.getValue())
+    );
+    return mkCone.Shape();
+}
+
 PROPERTY_SOURCE(Part::Torus, Part::Primitive)
 
 Torus::Torus()
@@ -793,21 +854,12 @@ short Torus::mustExecute() const
 
 App::DocumentObjectExecReturn* Torus::execute()
 {
-    if (Radius1.getValue() < Precision::Confusion()) {
-        return new App::DocumentObjectExecReturn("Radius of torus too small");
-    }
-    if (Radius2.getValue() < Precision::Confusion()) {
-        return new App::DocumentObjectExecReturn("Radius of torus too small");
-    }
     try {
-        TopoShape shape;
-        this->Shape.setValue(shape.makeTorus(
-            Radius1.getValue(),
-            Radius2.getValue(),
-            Angle1.getValue(),
-            Angle2.getValue(),
-            Angle3.getValue()
-        ));
+        TopoDS_Shape ResultShape = takeShape();
+        this->Shape.setValue(ResultShape);
+    }
+    catch (const Base::ValueError& e) {
+        return new App::DocumentObjectExecReturn(e.what());
     }
     catch (Standard_Failure& e) {
         return new App::DocumentObjectExecReturn(e.GetMessageString());
@@ -816,6 +868,24 @@ App::DocumentObjectExecReturn* Torus::execute()
     return Primitive::execute();
 }
 
+TopoDS_Shape Torus::makeShape() const
+{
+    if (Radius1.getValue() < Precision::Confusion()) {
+        throw Base::ValueError("Radius of torus too small");
+    }
+    if (Radius2.getValue() < Precision::Confusion()) {
+        throw Base::ValueError("Radius of torus too small");
+    }
+    TopoShape shape;
+    return shape.makeTorus(
+        Radius1.getValue(),
+        Radius2.getValue(),
+        Angle1.getValue(),
+        Angle2.getValue(),
+        Angle3.getValue()
+    );
+}
+
 PROPERTY_SOURCE(Part::Helix, Part::Primitive)
 
 const char* Part::Helix::LocalCSEnums[] = {"Right-handed", "Left-handed", nullptr};
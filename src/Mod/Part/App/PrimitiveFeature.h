@@ -24,6 +24,9 @@
 
 #pragma once
 
+#include <exception>
+#include <optional>
+
 #include <Mod/Part/PartGlobal.h>
 
 #include "AttachExtension.h"
@@ -47,16 +50,29 @@ public:
     App::DocumentObjectExecReturn* execute() override;
     short mustExecute() const override;
     PyObject* getPyObject() override;
+    void computeConcurrently() override;
     //@}
 
 protected:
     void Restore(Base::XMLReader& reader) override;
+    void onBeforeChange(const App::Property* prop) override;
     void onChanged(const App::Property* prop) override;
     void handleChangedPropertyType(
         Base::XMLReader& reader,
         const char* TypeName,
         App::Property* prop
     ) override;
+
+    /** Builds the shape of the primitive from its properties without changing any of
+     * them. Primitives implementing it can be computed concurrently with other objects.
+     */
+    virtual TopoDS_Shape makeShape() const;
+    /// Returns the shape built by computeConcurrently(), or builds it now
+    TopoDS_Shape takeShape();
+
+private:
+    std::optional<TopoDS_Shape> computedShape;
+    std::exception_ptr computeError;
 };
 
 class PartExport Vertex: public Part::Primitive
@@ -154,12 +170,18 @@ public:
     /// recalculate the feature
     App::DocumentObjectExecReturn* execute() override;
     short mustExecute() const override;
+    bool canRecomputeConcurrently() const override
+    {
+        return true;
+    }
     /// returns the type name of the ViewProvider
     const char* getViewProviderName() const override
     {
         return "PartGui::ViewProviderSphereParametric";
     }
     //@}
+protected:
+    TopoDS_Shape makeShape() const override;
 };
 
 class PartExport Ellipsoid: public Primitive
@@ -204,12 +226,18 @@ public:
     /// recalculate the feature
     App::DocumentObjectExecReturn* execute() override;
     short mustExecute() const override;
+    bool canRecomputeConcurrently() const override
+    {
+        return true;
+    }
     /// returns the type name of the ViewProvider
     const char* getViewProviderName() const override
     {
         return "PartGui::ViewProviderCylinderParametric";
     }
     //@}
+protected:
+    TopoDS_Shape makeShape() const override;
 };
 
 class PartExport Prism: public Primitive, public PrismExtension
@@ -280,12 +308,18 @@ public:
     /// recalculate the feature
     App::DocumentObjectExecReturn* execute() override;
     short mustExecute() const override;
+    bool canRecomputeConcurrently() const override
+    {
+        return true;
+    }
     /// returns the type name of the ViewProvider
     const char* getViewProviderName() const override
     {
         return "PartGui::ViewProviderConeParametric";
     }
     //@}
+protected:
+    TopoDS_Shape makeShape() const override;
 };
 
 class PartExport Torus: public Primitive
@@ -306,12 +340,18 @@ public:
     /// recalculate the feature
     App::DocumentObjectExecReturn* execute() override;
     short mustExecute() const override;
+    bool canRecomputeConcurrently() const override
+    {
+        return true;
+    }
     /// returns the type name of the ViewProvider
     const char* getViewProviderName() const override
     {
         return "PartGui::ViewProviderTorusParametric";
     }
     //@}
+protected:
+    TopoDS_Shape makeShape() const override;
 };
 
 class PartExport Helix: public Primitive
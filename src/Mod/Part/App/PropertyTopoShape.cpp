@@ -23,6 +23,7 @@
  ***************************************************************************/
 
 
+#include <memory>
 #include <sstream>
 #include <Bnd_Box.hxx>
 #include <BRepBndLib.hxx>
@@ -34,6 +35,7 @@
 #include <Standard_Version.hxx>
 #include <TopoDS.hxx>
 #include <TopTools_IndexedMapOfShape.hxx>
+#include <gp_Trsf.hxx>
 
 #include <App/Application.h>
 #include <App/Document.h>
@@ -59,6 +61,25 @@ using namespace Part;
 
 TYPESYSTEM_SOURCE(Part::PropertyPartShape, App::PropertyComplexGeoData)
 
+namespace
+{
+// Identifies the data written by SaveDocFile(). Shapes that share the same TShape with the same
+// orientation and placement have identical files.
+std::string sharedFileKey(const TopoDS_Shape& shape, const char* extension)
+{
+    std::ostringstream str;
+    str << std::hexfloat << "Part::PropertyPartShape" << extension << ':' << shape.TShape().get()
+        << ':' << static_cast<int>(shape.Orientation());
+    const gp_Trsf& trsf = shape.Location().Transformation();
+    for (int row = 1; row <= 3; row++) {
+        for (int col = 1; col <= 4; col++) {
+            str << ':' << trsf.Value(row, col);
+        }
+    }
+    return str.str();
+}
+}  // namespace
+
 PropertyPartShape::PropertyPartShape() = default;
 
 PropertyPartShape::~PropertyPartShape() = default;
@@ -389,9 +410,24 @@ void PropertyPartShape::Save(Base::Writer& writer) const
     bool binary = writer.getMode("BinaryBrep");
     bool toXML = writer.isForceXML();
     if (!toXML) {
-        writer.Stream() << " file=\""
-                        << writer.addFile(getFileName(binary ? ".bin" : ".brp").c_str(), this)
-                        << "\"/>\n";
+        const char* extension = binary ? ".bin" : ".brp";
+        // Older versions cannot read shared files, so this must be enabled explicitly
+        bool share = !_Shape.isNull()
+            && App::GetApplication()
+                   .GetParameterGroupByPath("User parameter:BaseApp/Preferences/Mod/Part/General")
+                   ->GetBool("ShareIdenticalShapes", false);
+        std::string key = share ? sharedFileKey(_Shape.getShape(), extension) : std::string();
+        std::string file = share ? writer.getSharedFile(key) : std::string();
+        if (!file.empty()) {
+            writer.Stream() << " shared=\"" << file << "\"/>\n";
+        }
+        else {
+            file = writer.addFile(getFileName(extension).c_str(), this);
+            if (share) {
+                writer.addSharedFile(key, file);
+            }
+            writer.Stream() << " file=\"" << file << "\"/>\n";
+        }
     }
     else if (binary) {
         writer.Stream() << " binary=\"1\">\n";
@@ -448,6 +484,7 @@ void PropertyPartShape::Restore(Base::XMLReader& reader)
 
     TopoShape shape;
 
+    _SharedShape = nullptr;
     if (reader.hasAttribute("file")) {
         std::string file = reader.getAttribute<const char*>("file");
         if (!file.empty()) {
@@ -455,6 +492,15 @@ void PropertyPartShape::Restore(Base::XMLReader& reader)
             reader.addFile(file.c_str(), this);
         }
     }
+    else if (reader.hasAttribute("shared")) {
+        // The shape is stored in the file of another property that was restored before. If that
+        // property isn't restored, e.g. when loading partially, read the file directly.
+        std::string file = reader.getAttribute<const char*>("shared");
+        _SharedShape = dynamic_cast<PropertyPartShape*>(reader.getFileObject(file.c_str()));
+        if (!_SharedShape) {
+            reader.addFile(file.c_str(), this);
+        }
+    }
     else if (reader.hasAttribute(("binary")) && reader.getAttribute<long>("binary")) {
         TopoShape shape;
         shape.importBinary(reader.beginCharStream());
@@ -534,6 +580,11 @@ void PropertyPartShape::Restore(Base::XMLReader& reader)
 
 void PropertyPartShape::afterRestore()
 {
+    if (_SharedShape) {
+        restoreSharedShape();
+        _SharedShape = nullptr;
+    }
+
     if (_Shape.isRestoreFailed()) {
         // this cause GeoFeature::updateElementReference() to call
         // PropertyLinkBase::updateElementReferences() with reverse = true, in
@@ -687,6 +738,17 @@ void PropertyPartShape::loadFromFile(Base::Reader& reader)
 }
 
 void PropertyPartShape::loadFromStream(Base::Reader& reader)
+{
+    TopoDS_Shape shape;
+    if (readFromStream(reader, shape)) {
+        setValue(shape);
+    }
+    else if (!reader.eof()) {
+        Base::Console().warning("Failed to load BRep file %s\n", reader.getFileName().c_str());
+    }
+}
+
+bool PropertyPartShape::readFromStream(Base::Reader& reader, TopoDS_Shape& shape)
 {
     // Save locale before calling OCCT. TopTools_ShapeSet::Read imbues the stream
     // with std::locale::classic() and restores it on return, but uses a non-RAII
@@ -694,18 +756,18 @@ void PropertyPartShape::loadFromStream(Base::Reader& reader)
     // the locale is not restored, leaving the stream with the classic locale whose
     // internal data is statically allocated and must not be freed.
     auto savedLocale = reader.getloc();
+    auto iostate = reader.exceptions();
     try {
         reader.exceptions(std::istream::failbit | std::istream::badbit);
         BRep_Builder builder;
-        TopoDS_Shape shape;
         BRepTools::Read(shape, reader, builder);
-        setValue(shape);
+        reader.exceptions(iostate);
+        return true;
     }
     catch (const std::exception&) {
         reader.imbue(savedLocale);
-        if (!reader.eof()) {
-            Base::Console().warning("Failed to load BRep file %s\n", reader.getFileName().c_str());
-        }
+        reader.exceptions(iostate);
+        return false;
     }
 }
 
@@ -781,6 +843,75 @@ void PropertyPartShape::RestoreDocFile(Base::Reader& reader)
     _Ver = ver;
 }
 
+void PropertyPartShape::restoreSharedShape()
+{
+    // Reuse the decoded shape but keep the element map of this property
+    std::string ver = _Ver;
+    auto elementMap = _Shape.resetElementMap();
+    TopoShape shape(_SharedShape->getValue());
+    shape.Hasher = _Shape.Hasher;
+    shape.resetElementMap(elementMap);
+    setValue(shape);
+    _Ver = ver;
+}
+
+void PropertyPartShape::onDocFileArchived()
+{
+    _ArchivedTransform = _Shape.getTransform();
+}
+
+bool PropertyPartShape::isDocFileUnchanged() const
+{
+    // setTransform() moves the shape without notifying a change of the value
+    return _Shape.getTransform() == _ArchivedTransform;
+}
+
+bool PropertyPartShape::canDecodeDocFile() const
+{
+    // Without direct access the data is copied to a temporary file first
+    return App::GetApplication()
+        .GetParameterGroupByPath("User parameter:BaseApp/Preferences/Mod/Part/General")
+        ->GetBool("DirectAccess", true);
+}
+
+std::function<void()> PropertyPartShape::decodeDocFile(Base::Reader& reader)
+{
+    // Only parse the shape here, the element map and the hasher are restored when applying it
+    auto shape = std::make_shared<TopoShape>();
+    bool loaded = true;
+    bool failed = false;
+    Base::FileInfo brep(reader.getFileName());
+    if (brep.hasExtension("bin")) {
+        shape->importBinary(reader);
+    }
+    else {
+        TopoDS_Shape occShape;
+        loaded = readFromStream(reader, occShape);
+        if (loaded) {
+            shape->setShape(occShape);
+        }
+        else {
+            failed = !reader.eof();
+        }
+    }
+
+    return [this, shape, loaded, failed, fileName = reader.getFileName()]() {
+        // like loadFromStream(), keep the current shape if the file couldn't be read
+        if (failed) {
+            Base::Console().warning("Failed to load BRep file %s\n", fileName.c_str());
+        }
+        if (!loaded) {
+            *shape = getValue();
+        }
+        std::string ver = _Ver;
+        auto elementMap = _Shape.resetElementMap();
+        shape->Hasher = _Shape.Hasher;
+        shape->resetElementMap(elementMap);
+        setValue(*shape);
+        _Ver = ver;
+    };
+}
+
 // -------------------------------------------------------------------------
 
 ShapeHistory::ShapeHistory(
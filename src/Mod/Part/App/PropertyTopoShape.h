@@ -93,6 +93,10 @@ public:
 
     void SaveDocFile(Base::Writer& writer) const override;
     void RestoreDocFile(Base::Reader& reader) override;
+    bool canDecodeDocFile() const override;
+    std::function<void()> decodeDocFile(Base::Reader& reader) override;
+    void onDocFileArchived() override;
+    bool isDocFileUnchanged() const override;
 
     App::Property* Copy() const override;
     void Paste(const App::Property& from) override;
@@ -116,12 +120,18 @@ private:
     void saveToFile(Base::Writer& writer) const;
     void loadFromFile(Base::Reader& reader);
     void loadFromStream(Base::Reader& reader);
+    static bool readFromStream(Base::Reader& reader, TopoDS_Shape& shape);
+    void restoreSharedShape();
 
 private:
     TopoShape _Shape;
     std::string _Ver;
     mutable int _HasherIndex = 0;
     mutable bool _SaveHasher = false;
+    // property whose file holds the shape of this property, only set while restoring
+    const PropertyPartShape* _SharedShape = nullptr;
+    // placement of the shape when its file was saved or restored
+    Base::Matrix4D _ArchivedTransform;
 };
 
 struct PartExport ShapeHistory
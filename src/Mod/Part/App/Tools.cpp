@@ -23,6 +23,10 @@
  ***************************************************************************/
 
 #include <cassert>
+#include <cstdint>
+#include <iomanip>
+#include <sstream>
+#include <BinTools.hxx>
 #include <BRep_Tool.hxx>
 #include <BRepAdaptor_Curve.hxx>
 #include <BRepAdaptor_Surface.hxx>
@@ -53,6 +57,7 @@
 #include <Poly_Connect.hxx>
 #include <Poly_Triangulation.hxx>
 #include <Precision.hxx>
+#include <Standard_Failure.hxx>
 #include <Standard_Mutex.hxx>
 #include <Standard_TypeMismatch.hxx>
 #include <Standard_Version.hxx>
@@ -902,3 +907,38 @@ Standard_Real Part::Tools::getDeflection(const TopoDS_Shape& shape, double devia
 {
     return getDeflection(getBounds(shape), deviation);
 }
+
+std::string Part::Tools::getShapeKey(const TopoDS_Shape& shape, const std::vector<double>& parameters)
+{
+#if OCC_VERSION_HEX < 0x070600
+    (void)shape;
+    (void)parameters;
+    return {};
+#else
+    if (shape.IsNull()) {
+        return {};
+    }
+
+    std::ostringstream str(std::ios::out | std::ios::binary);
+    try {
+        BinTools::Write(shape, str, Standard_False, Standard_False, BinTools_FormatVersion_CURRENT);
+    }
+    catch (const Standard_Failure&) {
+        return {};
+    }
+    for (double value : parameters) {
+        str.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    const std::string data = str.str();
+    std::uint64_t hash = 14695981039346656037ULL;
+    for (unsigned char c : data) {
+        hash ^= c;
+        hash *= 1099511628211ULL;
+    }
+
+    std::ostringstream key;
+    key << std::hex << std::setw(16) << std::setfill('0') << hash << std::dec << '-' << data.size();
+    return key.str();
+#endif
+}
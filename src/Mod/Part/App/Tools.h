@@ -41,6 +41,7 @@
 #include <TopLoc_Location.hxx>
 #include <TopoDS_Edge.hxx>
 #include <TopoDS_Face.hxx>
+#include <string>
 #include <vector>
 
 
@@ -361,6 +362,23 @@ public:
      * \return The computed deflection value.
      */
     static Standard_Real getDeflection(const TopoDS_Shape& shape, double deviation);
+
+    /**
+     * \brief Computes a key of the given shape to cache the results of an algorithm.
+     *
+     * The key is a 64-bit FNV-1a hash of the binary BRep data of the shape, without
+     * its triangulation, and of the parameters of the algorithm, followed by the size
+     * of that data. So it is stable across platforms and sessions, and a shape that is
+     * rebuilt or read again with the same geometry gets the same key.
+     *
+     * \param[in] shape The shape, including its location.
+     * \param[in] parameters The parameters that change the result of the algorithm.
+     *
+     * \return The key, or an empty string if the shape is null or cannot be serialized.
+     * With OCC versions before 7.6 it's always empty, because their binary format
+     * includes the triangulation.
+     */
+    static std::string getShapeKey(const TopoDS_Shape& shape, const std::vector<double>& parameters);
 };
 
 }  // namespace Part
@@ -0,0 +1,385 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "TessellationCache.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include <TopLoc_Location.hxx>
+#include <TopoDS_Shape.hxx>
+
+#include <App/Application.h>
+#include <Base/Console.h>
+#include <Base/FileInfo.h>
+#include <Base/Parameter.h>
+#include <Mod/Part/App/Tools.h>
+
+FC_LOG_LEVEL_INIT("Part", true, true);
+
+using namespace PartGui;
+namespace fs = std::filesystem;
+
+namespace
+{
+// "FCTS" and the version of the file layout
+constexpr std::uint32_t fileMagic = 0x53544346;
+constexpr std::uint32_t fileVersion = 1;
+
+static_assert(sizeof(SbVec3f) == 3 * sizeof(float), "SbVec3f must be three packed floats");
+
+std::size_t memSizeOf(const CoinGeometry& geometry)
+{
+    return sizeof(CoinGeometry) + (geometry.points.size() + geometry.normals.size()) * sizeof(SbVec3f)
+        + (geometry.faceIndices.size() + geometry.partIndices.size() + geometry.lineIndices.size())
+        * sizeof(int32_t);
+}
+
+template<typename T>
+void writeArray(std::ostream& str, const std::vector<T>& values)
+{
+    auto size = static_cast<std::uint64_t>(values.size());
+    str.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    str.write(reinterpret_cast<const char*>(values.data()), static_cast<std::streamsize>(size * sizeof(T)));
+}
+
+template<typename T>
+bool readArray(std::istream& str, std::vector<T>& values, std::uintmax_t& remaining)
+{
+    std::uint64_t size {};
+    if (!str.read(reinterpret_cast<char*>(&size), sizeof(size))) {
+        return false;
+    }
+    remaining -= std::min<std::uintmax_t>(remaining, sizeof(size));
+    // do not trust the size of a truncated or corrupt file
+    if (size > remaining / sizeof(T)) {
+        return false;
+    }
+    values.resize(size);
+    remaining -= size * sizeof(T);
+    return static_cast<bool>(
+        str.read(reinterpret_cast<char*>(values.data()), static_cast<std::streamsize>(size * sizeof(T)))
+    );
+}
+}  // namespace
+
+TessellationCache::TessellationCache()
+{
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part"
+    );
+    constexpr std::size_t MB = 1024 * 1024;
+    maxMemSize = static_cast<std::size_t>(std::max<long>(0, hGrp->GetInt("TessellationCacheSize", 256))) * MB;
+    if (hGrp->GetBool("TessellationDiskCache", true)) {
+        maxDiskSize = static_cast<std::size_t>(
+                          std::max<long>(0, hGrp->GetInt("TessellationDiskCacheSize", 1024))
+                      )
+            * MB;
+        setDirectory(App::Application::getUserCachePath() + "PartTessellation");
+    }
+}
+
+TessellationCache::TessellationCache(
+    std::size_t maxMemSize,
+    std::size_t maxDiskSize,
+    const std::string& directory
+)
+    : maxMemSize(maxMemSize)
+    , maxDiskSize(maxDiskSize)
+{
+    if (!directory.empty()) {
+        setDirectory(directory);
+    }
+}
+
+TessellationCache& TessellationCache::instance()
+{
+    static TessellationCache cache;
+    return cache;
+}
+
+bool TessellationCache::isEnabled() const
+{
+    return maxMemSize > 0 || !directory.empty();
+}
+
+std::size_t TessellationCache::getMaxMemSize() const
+{
+    return maxMemSize;
+}
+
+void TessellationCache::setDirectory(const std::string& path)
+{
+    // a directory without any space would only be written to
+    if (maxDiskSize == 0) {
+        return;
+    }
+
+    directory = path;
+    try {
+        fs::create_directories(Base::FileInfo::stringToPath(directory));
+        trimDirectory(true);
+    }
+    catch (const std::exception& e) {
+        FC_WARN("Cannot use tessellation cache directory " << directory << ": " << e.what());
+        directory.clear();
+    }
+}
+
+std::string TessellationCache::makeKey(
+    const TopoDS_Shape& shape,
+    double deviation,
+    double angularDeflection,
+    bool normalsFromUV
+)
+{
+    // the location is ignored by the tessellation, it's applied by the placement
+    return Part::Tools::getShapeKey(
+        shape.Located(TopLoc_Location()),
+        {deviation, angularDeflection, normalsFromUV ? 1.0 : 0.0}
+    );
+}
+
+CoinGeometry TessellationCache::tessellate(
+    const TopoDS_Shape& shape,
+    double deviation,
+    double angularDeflection,
+    bool normalsFromUV
+)
+{
+    // serializing and hashing the shape is wasted if nothing is cached
+    if (!isEnabled()) {
+        return ViewProviderPartExt::buildCoinGeometry(shape, deviation, angularDeflection, normalsFromUV);
+    }
+
+    CoinGeometry geometry;
+    std::string key = makeKey(shape, deviation, angularDeflection, normalsFromUV);
+    if (!key.empty() && find(key, geometry)) {
+        return geometry;
+    }
+
+    geometry = ViewProviderPartExt::buildCoinGeometry(shape, deviation, angularDeflection, normalsFromUV);
+    if (!key.empty()) {
+        insert(key, geometry);
+    }
+    return geometry;
+}
+
+bool TessellationCache::find(const std::string& key, CoinGeometry& geometry)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = index.find(key);
+        if (it != index.end()) {
+            entries.splice(entries.begin(), entries, it->second);
+            geometry = *it->second->second;
+            return true;
+        }
+    }
+
+    if (!readFile(key, geometry)) {
+        return false;
+    }
+    add(key, std::make_shared<const CoinGeometry>(geometry));
+    return true;
+}
+
+void TessellationCache::insert(const std::string& key, const CoinGeometry& geometry)
+{
+    add(key, std::make_shared<const CoinGeometry>(geometry));
+    writeFile(key, geometry);
+}
+
+void TessellationCache::clear()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.clear();
+    index.clear();
+    memSize = 0;
+}
+
+void TessellationCache::add(const std::string& key, std::shared_ptr<const CoinGeometry> geometry)
+{
+    std::size_t size = memSizeOf(*geometry);
+    if (size > maxMemSize) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (index.find(key) != index.end()) {
+        return;
+    }
+    entries.emplace_front(key, std::move(geometry));
+    index[key] = entries.begin();
+    memSize += size;
+
+    while (memSize > maxMemSize && !entries.empty()) {
+        memSize -= memSizeOf(*entries.back().second);
+        index.erase(entries.back().first);
+        entries.pop_back();
+    }
+}
+
+std::string TessellationCache::fileName(const std::string& key) const
+{
+    return directory + "/" + key + ".bin";
+}
+
+bool TessellationCache::readFile(const std::string& key, CoinGeometry& geometry) const
+{
+    if (directory.empty()) {
+        return false;
+    }
+
+    try {
+        fs::path path = Base::FileInfo::stringToPath(fileName(key));
+        std::error_code ec;
+        std::uintmax_t remaining = fs::file_size(path, ec);
+        if (ec) {
+            return false;
+        }
+
+        std::ifstream str(path, std::ios::in | std::ios::binary);
+        std::uint32_t magic {};
+        std::uint32_t version {};
+        std::int32_t pointStart {};
+        str.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+        str.read(reinterpret_cast<char*>(&version), sizeof(version));
+        str.read(reinterpret_cast<char*>(&pointStart), sizeof(pointStart));
+        if (!str || magic != fileMagic || version != fileVersion) {
+            return false;
+        }
+        remaining -= std::min<std::uintmax_t>(remaining, sizeof(magic) + sizeof(version) + sizeof(pointStart));
+
+        CoinGeometry result;
+        result.pointStart = pointStart;
+        if (!readArray(str, result.points, remaining) || !readArray(str, result.normals, remaining)
+            || !readArray(str, result.faceIndices, remaining)
+            || !readArray(str, result.partIndices, remaining)
+            || !readArray(str, result.lineIndices, remaining)) {
+            return false;
+        }
+        geometry = std::move(result);
+
+        // keep recently used files when trimming the directory
+        fs::last_write_time(path, fs::file_time_type::clock::now(), ec);
+        return true;
+    }
+    catch (const std::exception&) {
+        return false;
+    }
+}
+
+void TessellationCache::writeFile(const std::string& key, const CoinGeometry& geometry)
+{
+    if (directory.empty()) {
+        return;
+    }
+
+    std::uintmax_t size = 0;
+    try {
+        // write to a temporary file first so that no reader sees a partial file
+        std::ostringstream tmpName;
+        tmpName << fileName(key) << '.' << std::hash<std::thread::id> {}(std::this_thread::get_id())
+                << ".tmp";
+        fs::path tmp = Base::FileInfo::stringToPath(tmpName.str());
+        {
+            std::ofstream str(tmp, std::ios::out | std::ios::binary | std::ios::trunc);
+            auto pointStart = static_cast<std::int32_t>(geometry.pointStart);
+            str.write(reinterpret_cast<const char*>(&fileMagic), sizeof(fileMagic));
+            str.write(reinterpret_cast<const char*>(&fileVersion), sizeof(fileVersion));
+            str.write(reinterpret_cast<const char*>(&pointStart), sizeof(pointStart));
+            writeArray(str, geometry.points);
+            writeArray(str, geometry.normals);
+            writeArray(str, geometry.faceIndices);
+            writeArray(str, geometry.partIndices);
+            writeArray(str, geometry.lineIndices);
+            if (!str) {
+                str.close();
+                fs::remove(tmp);
+                return;
+            }
+            size = static_cast<std::uintmax_t>(str.tellp());
+        }
+        fs::rename(tmp, Base::FileInfo::stringToPath(fileName(key)));
+    }
+    catch (const std::exception& e) {
+        FC_LOG("Cannot write tessellation cache file: " << e.what());
+        return;
+    }
+
+    // keep the directory within its limit during long sessions, too
+    std::lock_guard<std::mutex> lock(diskMutex);
+    diskWritten += size;
+    if (diskWritten < maxDiskSize / 4) {
+        return;
+    }
+    diskWritten = 0;
+    try {
+        trimDirectory(false);
+    }
+    catch (const std::exception& e) {
+        FC_LOG("Cannot trim tessellation cache directory: " << e.what());
+    }
+}
+
+void TessellationCache::trimDirectory(bool removeTemporary) const
+{
+    std::vector<std::tuple<fs::file_time_type, std::uintmax_t, fs::path>> files;
+    std::uintmax_t total = 0;
+    for (const auto& entry : fs::directory_iterator(Base::FileInfo::stringToPath(directory))) {
+        if (!entry.is_regular_file()) {
+            continue;
+        }
+        std::error_code ec;
+        if (entry.path().extension() == ".tmp") {
+            // left over by a crashed session, otherwise it's being written by another thread
+            if (removeTemporary) {
+                fs::remove(entry.path(), ec);
+            }
+            continue;
+        }
+        std::uintmax_t size = entry.file_size(ec);
+        if (!ec) {
+            files.emplace_back(entry.last_write_time(ec), size, entry.path());
+            total += size;
+        }
+    }
+
+    // remove the least recently used files first
+    std::sort(files.begin(), files.end());
+    for (const auto& [time, size, path] : files) {
+        if (total <= maxDiskSize) {
+            break;
+        }
+        std::error_code ec;
+        if (fs::remove(path, ec)) {
+            total -= size;
+        }
+    }
+}
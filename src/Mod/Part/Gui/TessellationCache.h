@@ -0,0 +1,117 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <Mod/Part/PartGlobal.h>
+
+#include "ViewProviderExt.h"
+
+class TopoDS_Shape;
+
+namespace PartGui
+{
+
+/**
+ * Cache of the Coin geometry of tessellated shapes.
+ *
+ * The key is computed by Part::Tools::getShapeKey() from the shape, without its
+ * location, and the tessellation parameters. So a shape that is recomputed or read
+ * again with the same geometry finds the tessellation of its predecessor.
+ *
+ * Recently used entries are kept in memory up to the size set by the parameter
+ * Mod/Part/TessellationCacheSize (in MB). If Mod/Part/TessellationDiskCache is
+ * enabled each entry is also written to the PartTessellation folder of the user
+ * cache directory, which is trimmed to Mod/Part/TessellationDiskCacheSize (in MB)
+ * on startup and whenever a quarter of that size has been written. The parameters
+ * are read when the shared cache is created.
+ *
+ * All methods except instance() can be called from worker threads.
+ */
+class PartGuiExport TessellationCache
+{
+public:
+    /// Must be called from the main thread the first time
+    static TessellationCache& instance();
+
+    /**
+     * Creates a cache of at most \a maxMemSize bytes in memory and, unless
+     * \a directory is empty, of at most \a maxDiskSize bytes in that directory
+     */
+    TessellationCache(std::size_t maxMemSize, std::size_t maxDiskSize, const std::string& directory);
+
+    /// Whether entries are kept in memory or on disk at all
+    bool isEnabled() const;
+    std::size_t getMaxMemSize() const;
+
+    /// Returns the tessellation of \a shape from the cache or tessellates and adds it
+    CoinGeometry tessellate(
+        const TopoDS_Shape& shape,
+        double deviation,
+        double angularDeflection,
+        bool normalsFromUV
+    );
+
+    /// Returns the key of the tessellation or an empty string if the shape cannot be cached
+    static std::string makeKey(
+        const TopoDS_Shape& shape,
+        double deviation,
+        double angularDeflection,
+        bool normalsFromUV
+    );
+
+    bool find(const std::string& key, CoinGeometry& geometry);
+    void insert(const std::string& key, const CoinGeometry& geometry);
+    /// removes all entries from memory
+    void clear();
+
+private:
+    TessellationCache();
+
+    using Entry = std::pair<std::string, std::shared_ptr<const CoinGeometry>>;
+    void add(const std::string& key, std::shared_ptr<const CoinGeometry> geometry);
+    void setDirectory(const std::string& path);
+    std::string fileName(const std::string& key) const;
+    bool readFile(const std::string& key, CoinGeometry& geometry) const;
+    void writeFile(const std::string& key, const CoinGeometry& geometry);
+    void trimDirectory(bool removeTemporary) const;
+
+    std::mutex mutex;
+    // most recently used first
+    std::list<Entry> entries;
+    std::unordered_map<std::string, std::list<Entry>::iterator> index;
+    std::size_t memSize {0};
+    std::size_t maxMemSize {0};
+    std::size_t maxDiskSize {0};
+    std::string directory;
+    // bytes written to the directory since it was trimmed last
+    std::mutex diskMutex;
+    std::size_t diskWritten {0};
+};
+
+}  // namespace PartGui
@@ -0,0 +1,335 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include "TessellationScheduler.h"
+#include "TessellationCache.h"
+
+#include <algorithm>
+#include <map>
+#include <utility>
+
+#include <QtConcurrentMap>
+
+#include <BRepBuilderAPI_Copy.hxx>
+#include <Standard_Failure.hxx>
+
+#include <App/Application.h>
+#include <App/Document.h>
+#include <App/DocumentObject.h>
+#include <Base/Console.h>
+#include <Base/Parameter.h>
+#include <Gui/Application.h>
+
+FC_LOG_LEVEL_INIT("Part", true, true);
+
+using namespace PartGui;
+
+TessellationScheduler::TessellationScheduler(QObject* parent)
+    : QObject(parent)
+{
+    connect(&watcher, &QFutureWatcher<void>::finished, this, &TessellationScheduler::finish);
+    if (Gui::Application::Instance) {
+        connectFlushVisuals = Gui::Application::Instance->signalFlushVisuals.connect([this]() {
+            waitForDone();
+        });
+    }
+}
+
+TessellationScheduler& TessellationScheduler::instance()
+{
+    // intentionally never destroyed, worker threads may still refer to it on exit
+    static auto* scheduler = new TessellationScheduler;
+    return *scheduler;
+}
+
+bool TessellationScheduler::isBatching(const ViewProviderPartExt* vp)
+{
+    App::DocumentObject* obj = vp->getObject();
+    if (!obj || !obj->getDocument()) {
+        return false;
+    }
+
+    App::Document* doc = obj->getDocument();
+    bool restoring = doc->testStatus(App::Document::Restoring);
+    if (!restoring && !doc->testStatus(App::Document::Recomputing)) {
+        return false;
+    }
+
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part"
+    );
+    if (!hGrp->GetBool("ParallelTessellation", true)) {
+        return false;
+    }
+    if (restoring) {
+        return true;
+    }
+
+    // the result of an interactive edit of a few objects is shown at once
+    long minObjects = hGrp->GetInt("ParallelTessellationMinObjects", 10);
+    long pending = 0;
+    for (auto object : doc->getObjects()) {
+        if (object->testStatus(App::PendingRecompute) && ++pending >= minObjects) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void TessellationScheduler::getLevelParameters(int level, double& deviation, double& angularDeflection)
+{
+    for (int i = FinestLevel; i < level; ++i) {
+        deviation *= 4.0;
+        // keep a user defined deflection that is coarser than the limit
+        angularDeflection = std::min(angularDeflection * 2.0, std::max(angularDeflection, 90.0));
+    }
+}
+
+int TessellationScheduler::getLevelForScreenSize(float pixels)
+{
+    if (pixels >= 256.0F) {
+        return FinestLevel;
+    }
+    if (pixels >= 64.0F) {
+        return FinestLevel + 1;
+    }
+    return CoarsestLevel;
+}
+
+void TessellationScheduler::schedule(ViewProviderPartExt* vp, int level)
+{
+    toBeUpdated.push_back({Gui::ViewProviderWeakPtrT(vp), level});
+
+    // if method call was already scheduled there is no need to queue another one
+    if (scheduled) {
+        return;
+    }
+
+    scheduled = true;
+    QMetaObject::invokeMethod(this, &TessellationScheduler::flush, Qt::QueuedConnection);
+}
+
+void TessellationScheduler::schedule(
+    const TopoDS_Shape& shape,
+    double deviation,
+    double angularDeflection,
+    bool normalsFromUV,
+    Receiver receiver
+)
+{
+    Job job {Gui::ViewProviderWeakPtrT(nullptr), shape};
+    job.deviation = deviation;
+    job.angularDeflection = angularDeflection;
+    job.normalsFromUV = normalsFromUV;
+    job.level = FinestLevel;
+    job.receiver = std::move(receiver);
+    toBeTessellated.push_back(std::move(job));
+
+    if (scheduled) {
+        return;
+    }
+
+    scheduled = true;
+    QMetaObject::invokeMethod(this, &TessellationScheduler::flush, Qt::QueuedConnection);
+}
+
+void TessellationScheduler::waitForDone()
+{
+    while (!jobs.empty() || !toBeUpdated.empty() || !toBeTessellated.empty()) {
+        if (jobs.empty()) {
+            flush();
+            // nothing to do if all queued shapes are up to date
+            if (jobs.empty()) {
+                break;
+            }
+        }
+        watcher.waitForFinished();
+        // applies the results and starts the batch of the requests queued meanwhile
+        finish();
+    }
+}
+
+bool TessellationScheduler::isCurrent(const ViewProviderPartExt* vp, const Job& job)
+{
+    // skip a shape that has been replaced or rendered at this level meanwhile
+    if (!vp->VisualTouched && vp->lastRenderedShape.IsPartner(job.shape)
+        && vp->renderedLevel <= job.level) {
+        return false;
+    }
+    return vp->Deviation.getValue() == job.deviation
+        && vp->AngularDeflection.getValue() == job.angularDeflection
+        && vp->NormalsFromUV == job.normalsFromUV
+        && vp->getRenderedShape().getShape().IsPartner(job.shape);
+}
+
+void TessellationScheduler::copyShape(Job& job)
+{
+    // Shapes of different objects may share sub-shapes, so each worker meshes
+    // its own copy of the topology. The geometry itself is shared read-only.
+    try {
+        if (!job.shape.IsNull()) {
+            BRepBuilderAPI_Copy copier(job.shape, Standard_False);
+            job.copy = copier.Shape();
+        }
+    }
+    catch (const Standard_Failure& e) {
+        job.error = e.GetMessageString();
+    }
+}
+
+void TessellationScheduler::run(Job& job)
+{
+    try {
+        double deviation = job.deviation;
+        double angularDeflection = job.angularDeflection;
+        getLevelParameters(job.level, deviation, angularDeflection);
+        job.geometry = TessellationCache::instance().tessellate(
+            job.copy,
+            deviation,
+            angularDeflection,
+            job.normalsFromUV
+        );
+    }
+    catch (const Standard_Failure& e) {
+        job.error = e.GetMessageString();
+    }
+    catch (const std::exception& e) {
+        job.error = e.what();
+    }
+    catch (...) {
+        job.error = "Unknown error";
+    }
+}
+
+void TessellationScheduler::flush()
+{
+    scheduled = false;
+
+    // the next batch starts when the running one is finished
+    if (!jobs.empty()) {
+        return;
+    }
+
+    // merge the requests of a view provider, the finest explicit level wins
+    std::vector<std::pair<ViewProviderPartExt*, int>> requests;
+    std::map<ViewProviderPartExt*, std::size_t> handled;
+    for (auto& request : std::exchange(toBeUpdated, {})) {
+        auto vp = request.viewProvider.get<ViewProviderPartExt>();
+        if (!vp) {
+            continue;
+        }
+
+        auto [it, inserted] = handled.emplace(vp, requests.size());
+        if (inserted) {
+            requests.emplace_back(vp, request.level);
+            continue;
+        }
+
+        int& level = requests[it->second].second;
+        if (level == AutomaticLevel
+            || (request.level != AutomaticLevel && request.level < level)) {
+            level = request.level;
+        }
+    }
+
+    auto automatic = std::count_if(requests.begin(), requests.end(), [](const auto& request) {
+        return request.second == AutomaticLevel;
+    });
+
+    // let the user see all shapes of a large batch before any of them gets refined
+    ParameterGrp::handle hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part"
+    );
+    bool coarseFirst = hGrp->GetBool("LevelOfDetail", true)
+        && automatic >= hGrp->GetInt("LevelOfDetailMinShapes", 50);
+
+    for (auto [vp, level] : requests) {
+        if (level == AutomaticLevel) {
+            level = coarseFirst ? CoarsestLevel : FinestLevel;
+        }
+
+        TopoDS_Shape shape = vp->getRenderedShape().getShape();
+        if (!vp->VisualTouched && vp->lastRenderedShape.IsPartner(shape)
+            && vp->renderedLevel <= level) {
+            continue;
+        }
+
+        Job job {Gui::ViewProviderWeakPtrT(vp), shape};
+        job.deviation = vp->Deviation.getValue();
+        job.angularDeflection = vp->AngularDeflection.getValue();
+        job.normalsFromUV = vp->NormalsFromUV;
+        job.level = level;
+        copyShape(job);
+        jobs.push_back(std::move(job));
+    }
+
+    for (auto& job : std::exchange(toBeTessellated, {})) {
+        copyShape(job);
+        jobs.push_back(std::move(job));
+    }
+
+    if (!jobs.empty()) {
+        // create the cache on the main thread
+        TessellationCache::instance();
+        watcher.setFuture(QtConcurrent::map(jobs, [](Job& job) {
+            if (job.error.empty()) {
+                run(job);
+            }
+        }));
+    }
+}
+
+void TessellationScheduler::finish()
+{
+    // the batch may already have been applied by waitForDone()
+    if (watcher.isRunning()) {
+        return;
+    }
+
+    for (auto& job : std::exchange(jobs, {})) {
+        if (job.receiver) {
+            job.receiver(job.error.empty() ? &job.geometry : nullptr);
+            continue;
+        }
+
+        auto vp = job.viewProvider.get<ViewProviderPartExt>();
+        if (!vp || !isCurrent(vp, job)) {
+            continue;
+        }
+
+        if (!job.error.empty()) {
+            FC_ERR(
+                "Cannot compute Inventor representation for the shape of "
+                << vp->getObject()->getFullName() << ": " << job.error
+            );
+            vp->updateVisual(job.shape, nullptr);
+        }
+        else {
+            vp->updateVisual(job.shape, &job.geometry, job.level);
+        }
+    }
+
+    if (!toBeUpdated.empty() || !toBeTessellated.empty()) {
+        flush();
+    }
+}
+
+#include "moc_TessellationScheduler.cpp"
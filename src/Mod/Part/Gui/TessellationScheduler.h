@@ -0,0 +1,159 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/****************************************************************************
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <QFutureWatcher>
+#include <QObject>
+
+#include <TopoDS_Shape.hxx>
+
+#include <Gui/DocumentObserver.h>
+#include <fastsignals/signal.h>
+
+#include "ViewProviderExt.h"
+
+namespace PartGui
+{
+
+/**
+ * Tessellates the shapes of many view providers on worker threads.
+ *
+ * While a document is restored or many of its objects are recomputed
+ * ViewProviderPartExt::updateVisual() only queues the view provider. Once the
+ * control returns to the event loop the queued shapes are meshed and converted
+ * to Coin arrays concurrently, while the GUI stays responsive. Only the resulting
+ * geometry is applied to the scene graph on the main thread. The result of an
+ * interactive edit of a few objects is still shown at once.
+ *
+ * Large batches are tessellated progressively: every shape first gets a coarse
+ * level of detail, finer levels are requested by the view provider once it is
+ * rendered big enough on screen and are then computed in the background, too.
+ * All levels share the indexing of faces, edges and vertices, so exchanging them
+ * keeps selection and highlighting intact.
+ *
+ * Before the scene is measured, picked or rendered into an image, e.g. by ViewFit,
+ * getObjectInfo() or saveImage(), Gui::Application::signalFlushVisuals makes the
+ * scheduler wait for all queued shapes, so that the caller sees the same geometry
+ * as without batching.
+ */
+class TessellationScheduler final: public QObject
+{
+    Q_OBJECT
+
+public:
+    static TessellationScheduler& instance();
+
+    /// level of detail that uses the deviation and angular deflection of the view provider
+    static constexpr int FinestLevel = 0;
+    /// level of detail computed first for the shapes of large batches
+    static constexpr int CoarsestLevel = 2;
+    /// level used when scheduling a view provider, decided when the batch is flushed
+    static constexpr int AutomaticLevel = -1;
+
+    /**
+     * Whether the update of the visual of \a vp is to be scheduled
+     *
+     * This is the case while its document is restored, or recomputes at least
+     * ParallelTessellationMinObjects objects.
+     */
+    static bool isBatching(const ViewProviderPartExt* vp);
+
+    /// Scales the tessellation parameters of the finest level to the given \a level
+    static void getLevelParameters(int level, double& deviation, double& angularDeflection);
+
+    /// Returns the level of detail suitable for a shape spanning \a pixels on screen
+    static int getLevelForScreenSize(float pixels);
+
+    /**
+     * Schedules the tessellation of the rendered shape of \a vp.
+     *
+     * A view provider that is queued several times is tessellated only once, at
+     * the finest level requested.
+     */
+    void schedule(ViewProviderPartExt* vp, int level = AutomaticLevel);
+
+    /// Receives the tessellation of a shape, or null if it failed
+    using Receiver = std::function<void(const CoinGeometry*)>;
+
+    /**
+     * Schedules the tessellation of \a shape with the given parameters.
+     *
+     * The result is passed to \a receiver on the main thread, at the latest
+     * before waitForDone() returns.
+     */
+    void schedule(
+        const TopoDS_Shape& shape,
+        double deviation,
+        double angularDeflection,
+        bool normalsFromUV,
+        Receiver receiver
+    );
+
+    /// Tessellates all queued shapes and applies the results before returning
+    void waitForDone();
+
+private Q_SLOTS:
+    void flush();
+    void finish();
+
+private:
+    explicit TessellationScheduler(QObject* parent = nullptr);
+
+    struct Job
+    {
+        Gui::ViewProviderWeakPtrT viewProvider;
+        // the rendered shape and the copy that is meshed on the worker thread
+        TopoDS_Shape shape;
+        TopoDS_Shape copy;
+        double deviation {};
+        double angularDeflection {};
+        bool normalsFromUV {};
+        int level {};
+        CoinGeometry geometry;
+        std::string error;
+        // set for a shape that is not rendered by a view provider
+        Receiver receiver;
+    };
+
+    static bool isCurrent(const ViewProviderPartExt* vp, const Job& job);
+    static void copyShape(Job& job);
+    static void run(Job& job);
+
+    struct Request
+    {
+        Gui::ViewProviderWeakPtrT viewProvider;
+        int level;
+    };
+
+    std::vector<Request> toBeUpdated;
+    std::vector<Job> toBeTessellated;
+    std::vector<Job> jobs;
+    QFutureWatcher<void> watcher;
+    bool scheduled = false;
+    fastsignals::scoped_connection connectFlushVisuals;
+};
+
+}  // namespace PartGui
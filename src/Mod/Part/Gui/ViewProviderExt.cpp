@@ -30,6 +30,7 @@
 #include <BRepExtrema_DistShapeShape.hxx>
 #include <BRepMesh_IncrementalMesh.hxx>
 #include <gp_Trsf.hxx>
+#include <OSD_Parallel.hxx>
 #include <Precision.hxx>
 #include <Poly_Array1OfTriangle.hxx>
 #include <Poly_Polygon3D.hxx>
@@ -50,13 +51,20 @@
 
 #include <QAction>
 #include <QMenu>
+#include <optional>
 #include <sstream>
 
+#include <Inventor/SbBox2f.h>
 #include <Inventor/SoPickedPoint.h>
+#include <Inventor/actions/SoGLRenderAction.h>
 #include <Inventor/details/SoFaceDetail.h>
 #include <Inventor/details/SoLineDetail.h>
 #include <Inventor/details/SoPointDetail.h>
+#include <Inventor/elements/SoModelMatrixElement.h>
+#include <Inventor/elements/SoViewVolumeElement.h>
+#include <Inventor/elements/SoViewportRegionElement.h>
 #include <Inventor/errors/SoDebugError.h>
+#include <Inventor/nodes/SoCallback.h>
 #include <Inventor/nodes/SoCoordinate3.h>
 #include <Inventor/nodes/SoDrawStyle.h>
 #include <Inventor/nodes/SoMaterial.h>
@@ -92,6 +100,8 @@
 #include "SoBrepFaceSet.h"
 #include "SoBrepPointSet.h"
 #include "TaskFaceAppearances.h"
+#include "TessellationCache.h"
+#include "TessellationScheduler.h"
 
 
 FC_LOG_LEVEL_INIT("Part", true, true)
@@ -235,6 +245,9 @@ ViewProviderPartExt::ViewProviderPartExt()
     nodeset = new SoBrepPointSet();
     nodeset->setViewProvider(this);
     nodeset->ref();
+    pcLevelOfDetail = new SoCallback();
+    pcLevelOfDetail->setCallback(levelOfDetailCallback, this);
+    pcLevelOfDetail->ref();
 
     pcFaceBind = new SoMaterialBinding();
     pcFaceBind->ref();
@@ -294,6 +307,7 @@ ViewProviderPartExt::~ViewProviderPartExt()
     normb->unref();
     lineset->unref();
     nodeset->unref();
+    pcLevelOfDetail->unref();
 }
 
 PyObject* ViewProviderPartExt::getPyObject()
@@ -1043,14 +1057,20 @@ void ViewProviderPartExt::setupCoinGeometry(
     bool normalsFromUV
 )
 {
+    CoinGeometry geometry = buildCoinGeometry(shape, deviation, angularDeflection, normalsFromUV);
+    applyCoinGeometry(geometry, coords, faceset, norm, lineset, nodeset);
+}
+
+CoinGeometry ViewProviderPartExt::buildCoinGeometry(
+    TopoDS_Shape shape,
+    double deviation,
+    double angularDeflection,
+    bool normalsFromUV
+)
+{
+    CoinGeometry geometry;
     if (Part::Tools::isShapeEmpty(shape)) {
-        coords->point.setNum(0);
-        norm->vector.setNum(0);
-        faceset->coordIndex.setNum(0);
-        faceset->partIndex.setNum(0);
-        lineset->coordIndex.setNum(0);
-        nodeset->startIndex.setValue(0);
-        return;
+        return geometry;
     }
 
     // time measurement and book keeping
@@ -1060,8 +1080,6 @@ void ViewProviderPartExt::setupCoinGeometry(
     int numTriangles = 0,
         numNodes = 0, numNorms = 0, numFaces = 0, numEdges = 0, numLines = 0;
 
-    std::set<int> faceEdges;
-
     // calculating the deflection value
     Standard_Real deflection = Part::Tools::getDeflection(shape, deviation);
 
@@ -1100,62 +1118,74 @@ void ViewProviderPartExt::setupCoinGeometry(
     TopLoc_Location aLoc;
     shape.Location(aLoc);
 
-    // count triangles and nodes in the mesh
+    // get an indexed map of faces and edges
     TopTools_IndexedMapOfShape faceMap;
     TopExp::MapShapes(shape, TopAbs_FACE, faceMap);
-    for (int i = 1; i <= faceMap.Extent(); i++) {
-        Handle(Poly_Triangulation) mesh = BRep_Tool::Triangulation(TopoDS::Face(faceMap(i)), aLoc);
-
+    TopTools_IndexedMapOfShape edgeMap;
+    TopExp::MapShapes(shape, TopAbs_EDGE, edgeMap);
+    numFaces = faceMap.Extent();
+    numEdges = edgeMap.Extent();
+
+    // The triangulation of each face and the offsets of its nodes and triangles, so that the
+    // faces can be processed independently afterwards.
+    std::vector<Handle(Poly_Triangulation)> meshes(numFaces);
+    std::vector<TopLoc_Location> meshLocations(numFaces);
+    std::vector<int> nodeOffsets(numFaces + 1, 0);
+    std::vector<int> triaOffsets(numFaces + 1, 0);
+    std::vector<std::vector<std::pair<int, TopoDS_Edge>>> faceEdges(numFaces);
+    std::vector<bool> isFaceEdge(numEdges + 1, false);
+
+    for (int i = 0; i < numFaces; i++) {
+        const TopoDS_Face& actFace = TopoDS::Face(faceMap(i + 1));
+        Handle(Poly_Triangulation) mesh = BRep_Tool::Triangulation(actFace, meshLocations[i]);
         if (mesh.IsNull()) {
-            mesh = Part::Tools::triangulationOfFace(TopoDS::Face(faceMap(i)));
+            mesh = Part::Tools::triangulationOfFace(actFace);
         }
 
         // Note: we must also count empty faces
+        int nbNodesInFace = 0;
+        int nbTriInFace = 0;
         if (!mesh.IsNull()) {
-            numTriangles += mesh->NbTriangles();
-            numNodes += mesh->NbNodes();
-            numNorms += mesh->NbNodes();
+            nbNodesInFace = mesh->NbNodes();
+            nbTriInFace = mesh->NbTriangles();
         }
+        meshes[i] = mesh;
+        nodeOffsets[i + 1] = nodeOffsets[i] + nbNodesInFace;
+        triaOffsets[i + 1] = triaOffsets[i] + nbTriInFace;
 
         TopExp_Explorer xp;
-        for (xp.Init(faceMap(i), TopAbs_EDGE); xp.More(); xp.Next()) {
-            faceEdges.insert(Part::ShapeMapHasher {}(xp.Current()));
+        for (xp.Init(actFace, TopAbs_EDGE); xp.More(); xp.Next()) {
+            int edgeIndex = edgeMap.FindIndex(xp.Current());
+            isFaceEdge[edgeIndex] = true;
+            if (!mesh.IsNull()) {
+                faceEdges[i].emplace_back(edgeIndex, TopoDS::Edge(xp.Current()));
+            }
         }
-        numFaces++;
     }
 
-    // get an indexed map of edges
-    TopTools_IndexedMapOfShape edgeMap;
-    TopExp::MapShapes(shape, TopAbs_EDGE, edgeMap);
-
-    // key is the edge number, value the coord indexes. This is needed to keep the same order as
-    // the edges.
-    std::map<int, std::vector<int32_t>> lineSetMap;
-    std::set<int> edgeIdxSet;
-    std::vector<int32_t> edgeVector;
-
-    // count and index the edges
-    for (int i = 1; i <= edgeMap.Extent(); i++) {
-        edgeIdxSet.insert(i);
-        numEdges++;
-
-        const TopoDS_Edge& aEdge = TopoDS::Edge(edgeMap(i));
+    numTriangles = triaOffsets[numFaces];
+    numNorms = nodeOffsets[numFaces];
+    numNodes = numNorms;
+
+    // handling of the free edge that are not associated to a face
+    // Note: The assumption that if for an edge BRep_Tool::Polygon3D
+    // returns a valid object is wrong. This e.g. happens for ruled
+    // surfaces which gets created by two edges or wires.
+    // So, we have to remember the edges associated to a face.
+    // If a given edge is not in this list we know it's really
+    // a free edge.
+    std::vector<std::pair<int, Handle(Poly_Polygon3D)>> freeEdges;
+    std::vector<TopLoc_Location> freeEdgeLocations;
+    for (int i = 1; i <= numEdges; i++) {
+        if (isFaceEdge[i]) {
+            continue;
+        }
         TopLoc_Location aLoc;
-
-        // handling of the free edge that are not associated to a face
-        // Note: The assumption that if for an edge BRep_Tool::Polygon3D
-        // returns a valid object is wrong. This e.g. happens for ruled
-        // surfaces which gets created by two edges or wires.
-        // So, we have to store the hashes of the edges associated to a face.
-        // If the hash of a given edge is not in this list we know it's really
-        // a free edge.
-        int hash = Part::ShapeMapHasher {}(aEdge);
-        if (faceEdges.find(hash) == faceEdges.end()) {
-            Handle(Poly_Polygon3D) aPoly = Part::Tools::polygonOfEdge(aEdge, aLoc);
-            if (!aPoly.IsNull()) {
-                int nbNodesInEdge = aPoly->NbNodes();
-                numNodes += nbNodesInEdge;
-            }
+        Handle(Poly_Polygon3D) aPoly = Part::Tools::polygonOfEdge(TopoDS::Edge(edgeMap(i)), aLoc);
+        if (!aPoly.IsNull()) {
+            numNodes += aPoly->NbNodes();
+            freeEdges.emplace_back(i, aPoly);
+            freeEdgeLocations.push_back(aLoc);
         }
     }
 
@@ -1164,37 +1194,33 @@ void ViewProviderPartExt::setupCoinGeometry(
     TopExp::MapShapes(shape, TopAbs_VERTEX, vertexMap);
     numNodes += vertexMap.Extent();
 
-    // create memory for the nodes and indexes
-    coords->point.setNum(numNodes);
-    norm->vector.setNum(numNorms);
-    faceset->coordIndex.setNum(numTriangles * 4);
-    faceset->partIndex.setNum(numFaces);
+    // create memory for the nodes and indexes and preset the normal vector with null vector
+    geometry.points.resize(numNodes);
+    geometry.normals.assign(numNorms, SbVec3f(0.0, 0.0, 0.0));
+    geometry.faceIndices.resize(static_cast<std::size_t>(numTriangles) * 4);
+    geometry.partIndices.resize(numFaces);
 
-    // get the raw memory for fast fill up
-    SbVec3f* verts = coords->point.startEditing();
-    SbVec3f* norms = norm->vector.startEditing();
-    int32_t* index = faceset->coordIndex.startEditing();
-    int32_t* parts = faceset->partIndex.startEditing();
+    SbVec3f* verts = geometry.points.data();
+    SbVec3f* norms = geometry.normals.data();
+    int32_t* index = geometry.faceIndices.data();
+    int32_t* parts = geometry.partIndices.data();
 
-    // preset the normal vector with null vector
-    for (int i = 0; i < numNorms; i++) {
-        norms[i] = SbVec3f(0.0, 0.0, 0.0);
-    }
+    // the coord indexes of the edges lying on a face, collected per face
+    std::vector<std::vector<std::pair<int, std::vector<int32_t>>>> faceLines(numFaces);
 
-    int ii = 0, faceNodeOffset = 0, faceTriaOffset = 0;
-    for (int i = 1; i <= faceMap.Extent(); i++, ii++) {
-        TopLoc_Location aLoc;
-        const TopoDS_Face& actFace = TopoDS::Face(faceMap(i));
-        // get the mesh of the shape
-        Handle(Poly_Triangulation) mesh = BRep_Tool::Triangulation(actFace, aLoc);
-        if (mesh.IsNull()) {
-            mesh = Part::Tools::triangulationOfFace(actFace);
-        }
+    // Each face only writes to its own range of nodes, normals and indexes
+    auto fillFace = [&](const int ii) {
+        const Handle(Poly_Triangulation)& mesh = meshes[ii];
         if (mesh.IsNull()) {
             parts[ii] = 0;
-            continue;
+            return;
         }
 
+        const TopoDS_Face& actFace = TopoDS::Face(faceMap(ii + 1));
+        const TopLoc_Location& aLoc = meshLocations[ii];
+        const int faceNodeOffset = nodeOffsets[ii];
+        const int faceTriaOffset = triaOffsets[ii];
+
         // getting the transformation of the shape/face
         gp_Trsf myTransf;
         Standard_Boolean identity = true;
@@ -1215,8 +1241,7 @@ void ViewProviderPartExt::setupCoinGeometry(
         const TColgp_Array1OfPnt& Nodes = mesh->Nodes();
         TColgp_Array1OfDir Normals(Nodes.Lower(), Nodes.Upper());
 #else
-        int numNodes = mesh->NbNodes();
-        TColgp_Array1OfDir Normals(1, numNodes);
+        TColgp_Array1OfDir Normals(1, nbNodesInFace);
 #endif
         if (normalsFromUV) {
             Part::Tools::getPointNormals(actFace, mesh, Normals);
@@ -1294,95 +1319,88 @@ void ViewProviderPartExt::setupCoinGeometry(
 
         parts[ii] = nbTriInFace;  // new part
 
+        // normalize the normals of this face
+        for (int i = faceNodeOffset; i < faceNodeOffset + nbNodesInFace; i++) {
+            norms[i].normalize();
+        }
+
         // handling the edges lying on this face
-        TopExp_Explorer Exp;
-        for (Exp.Init(actFace, TopAbs_EDGE); Exp.More(); Exp.Next()) {
-            const TopoDS_Edge& curEdge = TopoDS::Edge(Exp.Current());
-            // get the overall index of this edge
-            int edgeIndex = edgeMap.FindIndex(curEdge);
-            edgeVector.push_back((int32_t)edgeIndex - 1);
-            // already processed this index ?
-            if (edgeIdxSet.find(edgeIndex) != edgeIdxSet.end()) {
-
-                // this holds the indices of the edge's triangulation to the current polygon
-                Handle(Poly_PolygonOnTriangulation)
-                    aPoly = BRep_Tool::PolygonOnTriangulation(curEdge, mesh, aLoc);
-                if (aPoly.IsNull()) {
-                    continue;  // polygon does not exist
-                }
+        for (const auto& [edgeIndex, curEdge] : faceEdges[ii]) {
+            // this holds the indices of the edge's triangulation to the current polygon
+            Handle(Poly_PolygonOnTriangulation)
+                aPoly = BRep_Tool::PolygonOnTriangulation(curEdge, mesh, aLoc);
+            if (aPoly.IsNull()) {
+                continue;  // polygon does not exist
+            }
 
-                // getting the indexes of the edge polygon
-                const TColStd_Array1OfInteger& indices = aPoly->Nodes();
-                for (Standard_Integer i = indices.Lower(); i <= indices.Upper(); i++) {
-                    int nodeIndex = indices(i);
-                    int index = faceNodeOffset + nodeIndex - 1;
-                    lineSetMap[edgeIndex].push_back(index);
-
-                    // usually the coordinates for this edge are already set by the
-                    // triangles of the face this edge belongs to. However, there are
-                    // rare cases where some points are only referenced by the polygon
-                    // but not by any triangle. Thus, we must apply the coordinates to
-                    // make sure that everything is properly set.
+            // getting the indexes of the edge polygon
+            std::vector<int32_t> lineIndexes;
+            const TColStd_Array1OfInteger& indices = aPoly->Nodes();
+            for (Standard_Integer i = indices.Lower(); i <= indices.Upper(); i++) {
+                int nodeIndex = indices(i);
+                int index = faceNodeOffset + nodeIndex - 1;
+                lineIndexes.push_back(index);
+
+                // usually the coordinates for this edge are already set by the
+                // triangles of the face this edge belongs to. However, there are
+                // rare cases where some points are only referenced by the polygon
+                // but not by any triangle. Thus, we must apply the coordinates to
+                // make sure that everything is properly set.
 #if OCC_VERSION_HEX < 0x070600
-                    gp_Pnt p(Nodes(nodeIndex));
+                gp_Pnt p(Nodes(nodeIndex));
 #else
-                    gp_Pnt p(mesh->Node(nodeIndex));
+                gp_Pnt p(mesh->Node(nodeIndex));
 #endif
-                    if (!identity) {
-                        p.Transform(myTransf);
-                    }
-                    verts[index] = Base::convertTo<SbVec3f>(p);
+                if (!identity) {
+                    p.Transform(myTransf);
                 }
-
-                // remove the handled edge index from the set
-                edgeIdxSet.erase(edgeIndex);
+                verts[index] = Base::convertTo<SbVec3f>(p);
             }
+            faceLines[ii].emplace_back(edgeIndex, std::move(lineIndexes));
         }
+    };
 
-        edgeVector.push_back(-1);
+    OSD_Parallel::For(0, numFaces, fillFace, numFaces < 2);
 
-        // counting up the per Face offsets
-        faceNodeOffset += nbNodesInFace;
-        faceTriaOffset += nbTriInFace;
+    // key is the edge number, value the coord indexes. This is needed to keep the same order as
+    // the edges. An edge shared by several faces is taken from the first one.
+    std::map<int, std::vector<int32_t>> lineSetMap;
+    for (auto& lines : faceLines) {
+        for (auto& [edgeIndex, lineIndexes] : lines) {
+            lineSetMap.emplace(edgeIndex, std::move(lineIndexes));
+        }
     }
 
     // handling of the free edges
-    for (int i = 1; i <= edgeMap.Extent(); i++) {
-        const TopoDS_Edge& aEdge = TopoDS::Edge(edgeMap(i));
+    int faceNodeOffset = nodeOffsets[numFaces];
+    for (std::size_t k = 0; k < freeEdges.size(); k++) {
+        const auto& [i, aPoly] = freeEdges[k];
+        const TopLoc_Location& aLoc = freeEdgeLocations[k];
         Standard_Boolean identity = true;
         gp_Trsf myTransf;
-        TopLoc_Location aLoc;
-
-        // handling of the free edge that are not associated to a face
-        int hash = Part::ShapeMapHasher {}(aEdge);
-        if (faceEdges.find(hash) == faceEdges.end()) {
-            Handle(Poly_Polygon3D) aPoly = Part::Tools::polygonOfEdge(aEdge, aLoc);
-            if (!aPoly.IsNull()) {
-                if (!aLoc.IsIdentity()) {
-                    identity = false;
-                    myTransf = aLoc.Transformation();
-                }
+        if (!aLoc.IsIdentity()) {
+            identity = false;
+            myTransf = aLoc.Transformation();
+        }
 
-                const TColgp_Array1OfPnt& aNodes = aPoly->Nodes();
-                int nbNodesInEdge = aPoly->NbNodes();
-
-                gp_Pnt pnt;
-                for (Standard_Integer j = 1; j <= nbNodesInEdge; j++) {
-                    pnt = aNodes(j);
-                    if (!identity) {
-                        pnt.Transform(myTransf);
-                    }
-                    int index = faceNodeOffset + j - 1;
-                    verts[index] = Base::convertTo<SbVec3f>(pnt);
-                    lineSetMap[i].push_back(index);
-                }
+        const TColgp_Array1OfPnt& aNodes = aPoly->Nodes();
+        int nbNodesInEdge = aPoly->NbNodes();
 
-                faceNodeOffset += nbNodesInEdge;
+        gp_Pnt pnt;
+        for (Standard_Integer j = 1; j <= nbNodesInEdge; j++) {
+            pnt = aNodes(j);
+            if (!identity) {
+                pnt.Transform(myTransf);
             }
+            int index = faceNodeOffset + j - 1;
+            verts[index] = Base::convertTo<SbVec3f>(pnt);
+            lineSetMap[i].push_back(index);
         }
+
+        faceNodeOffset += nbNodesInEdge;
     }
 
-    nodeset->startIndex.setValue(faceNodeOffset);
+    geometry.pointStart = faceNodeOffset;
     for (int i = 0; i < vertexMap.Extent(); i++) {
         const TopoDS_Vertex& aVertex = TopoDS::Vertex(vertexMap(i + 1));
         gp_Pnt pnt = BRep_Tool::Pnt(aVertex);
@@ -1390,33 +1408,11 @@ void ViewProviderPartExt::setupCoinGeometry(
         verts[faceNodeOffset + i] = Base::convertTo<SbVec3f>(pnt);
     }
 
-    // normalize all normals
-    for (int i = 0; i < numNorms; i++) {
-        norms[i].normalize();
-    }
-
-    std::vector<int32_t> lineSetCoords;
     for (const auto& it : lineSetMap) {
-        lineSetCoords.insert(lineSetCoords.end(), it.second.begin(), it.second.end());
-        lineSetCoords.push_back(-1);
+        geometry.lineIndices.insert(geometry.lineIndices.end(), it.second.begin(), it.second.end());
+        geometry.lineIndices.push_back(-1);
     }
-
-    // preset the index vector size
-    numLines = lineSetCoords.size();
-    lineset->coordIndex.setNum(numLines);
-    int32_t* lines = lineset->coordIndex.startEditing();
-
-    int l = 0;
-    for (auto it = lineSetCoords.begin(); it != lineSetCoords.end(); ++it, l++) {
-        lines[l] = *it;
-    }
-
-    // end the editing of the nodes
-    coords->point.finishEditing();
-    norm->vector.finishEditing();
-    faceset->coordIndex.finishEditing();
-    faceset->partIndex.finishEditing();
-    lineset->coordIndex.finishEditing();
+    numLines = static_cast<int>(geometry.lineIndices.size());
 
 #ifdef FC_DEBUG
     Base::Console().log(
@@ -1432,6 +1428,32 @@ void ViewProviderPartExt::setupCoinGeometry(
         numLines
     );
 #endif
+
+    return geometry;
+}
+
+void ViewProviderPartExt::applyCoinGeometry(
+    const CoinGeometry& geometry,
+    SoCoordinate3* coords,
+    SoBrepFaceSet* faceset,
+    SoNormal* norm,
+    SoBrepEdgeSet* lineset,
+    SoBrepPointSet* nodeset
+)
+{
+    auto copyValues = [](auto& field, const auto& values) {
+        field.setNum(static_cast<int>(values.size()));
+        auto data = field.startEditing();
+        std::copy(values.begin(), values.end(), data);
+        field.finishEditing();
+    };
+
+    copyValues(coords->point, geometry.points);
+    copyValues(norm->vector, geometry.normals);
+    copyValues(faceset->coordIndex, geometry.faceIndices);
+    copyValues(faceset->partIndex, geometry.partIndices);
+    copyValues(lineset->coordIndex, geometry.lineIndices);
+    nodeset->startIndex.setValue(geometry.pointStart);
 }
 
 void ViewProviderPartExt::setupCoinGeometry(
@@ -1472,9 +1494,47 @@ void ViewProviderPartExt::updateVisual()
         return;
     }
 
+    // Let the shapes of a restored or recomputed document be tessellated together
+    if (TessellationScheduler::isBatching(this)) {
+        VisualTouched = true;
+        TessellationScheduler::instance().schedule(this);
+        return;
+    }
+
+    std::optional<CoinGeometry> geometry;
+    try {
+        geometry = TessellationCache::instance().tessellate(
+            shape,
+            Deviation.getValue(),
+            AngularDeflection.getValue(),
+            NormalsFromUV
+        );
+    }
+    catch (const Standard_Failure& e) {
+        FC_ERR(
+            "Cannot compute Inventor representation for the shape of "
+            << pcObject->getFullName() << ": " << e.GetMessageString()
+        );
+    }
+    catch (...) {
+        FC_ERR("Cannot compute Inventor representation for the shape of " << pcObject->getFullName());
+    }
+
+    updateVisual(shape, geometry ? &*geometry : nullptr);
+}
+
+void ViewProviderPartExt::updateVisual(const TopoDS_Shape& shape, const CoinGeometry* geometry, int level)
+{
     Gui::SoUpdateVBOAction action;
     action.apply(this->faceset);
 
+    // all levels of detail share the indexing, so refining keeps selection and highlighting
+    if (geometry && !VisualTouched && lastRenderedShape.IsPartner(shape)) {
+        applyCoinGeometry(*geometry, coords, faceset, norm, lineset, nodeset);
+        setRenderedLevel(level, *geometry);
+        return;
+    }
+
     // Clear selection
     Gui::SoSelectionElementAction saction(Gui::SoSelectionElementAction::None);
     saction.apply(this->faceset);
@@ -1487,32 +1547,14 @@ void ViewProviderPartExt::updateVisual()
     haction.apply(this->lineset);
     haction.apply(this->nodeset);
 
-    try {
-        setupCoinGeometry(
-            shape,
-            coords,
-            faceset,
-            norm,
-            lineset,
-            nodeset,
-            Deviation.getValue(),
-            AngularDeflection.getValue(),
-            NormalsFromUV
-        );
+    if (geometry) {
+        applyCoinGeometry(*geometry, coords, faceset, norm, lineset, nodeset);
+        setRenderedLevel(level, *geometry);
 
         lastRenderedShape = shape;
 
         VisualTouched = false;
     }
-    catch (const Standard_Failure& e) {
-        FC_ERR(
-            "Cannot compute Inventor representation for the shape of "
-            << pcObject->getFullName() << ": " << e.GetMessageString()
-        );
-    }
-    catch (...) {
-        FC_ERR("Cannot compute Inventor representation for the shape of " << pcObject->getFullName());
-    }
 
     // The material has to be checked again
     setHighlightedFaces(ShapeAppearance.getValues());
@@ -1520,6 +1562,66 @@ void ViewProviderPartExt::updateVisual()
     setHighlightedPoints(PointColorArray.getValue());
 }
 
+void ViewProviderPartExt::setRenderedLevel(int level, const CoinGeometry& geometry)
+{
+    renderedLevel = requestedLevel = level;
+
+    int index = pcRoot->findChild(pcLevelOfDetail);
+    if (level == TessellationScheduler::FinestLevel) {
+        // the callback node prevents render caching, so only keep it as long as needed
+        if (index >= 0) {
+            pcRoot->removeChild(index);
+        }
+        return;
+    }
+
+    levelBoundBox.makeEmpty();
+    for (const auto& point : geometry.points) {
+        levelBoundBox.extendBy(point);
+    }
+
+    if (index < 0) {
+        pcRoot->insertChild(pcLevelOfDetail, pcRoot->findChild(coords));
+    }
+}
+
+void ViewProviderPartExt::levelOfDetailCallback(void* data, SoAction* action)
+{
+    auto vp = static_cast<ViewProviderPartExt*>(data);
+    if (!action->isOfType(SoGLRenderAction::getClassTypeId()) || vp->levelBoundBox.isEmpty()
+        || vp->requestedLevel == TessellationScheduler::FinestLevel) {
+        return;
+    }
+
+    SoState* state = action->getState();
+    SbBox3f box = vp->levelBoundBox;
+    box.transform(SoModelMatrixElement::get(state));
+
+    // project the corners of the bounding box to normalized screen coordinates
+    const SbViewVolume& volume = SoViewVolumeElement::get(state);
+    const SbVec3f& min = box.getMin();
+    const SbVec3f& max = box.getMax();
+    SbBox2f screen;
+    for (int i = 0; i < 8; ++i) {
+        SbVec3f corner((i & 1) ? max[0] : min[0], (i & 2) ? max[1] : min[1], (i & 4) ? max[2] : min[2]);
+        SbVec3f projected;
+        volume.projectToScreen(corner, projected);
+        screen.extendBy(SbVec2f(projected[0], projected[1]));
+    }
+
+    float width {};
+    float height {};
+    screen.getSize(width, height);
+    const SbVec2s& size = SoViewportRegionElement::get(state).getViewportSizePixels();
+    float pixels = std::max(width * size[0], height * size[1]);
+
+    int level = TessellationScheduler::getLevelForScreenSize(pixels);
+    if (level < vp->requestedLevel) {
+        vp->requestedLevel = level;
+        TessellationScheduler::instance().schedule(vp, level);
+    }
+}
+
 void ViewProviderPartExt::forceUpdate(bool enable)
 {
     if (enable) {
@@ -28,6 +28,10 @@
 
 
 #include <map>
+#include <vector>
+
+#include <Inventor/SbBox3f.h>
+#include <Inventor/SbVec3f.h>
 
 #include <App/PropertyUnits.h>
 #include <Gui/ViewProviderGeometryObject.h>
@@ -57,6 +61,8 @@ class SoNormal;
 class SoNormalBinding;
 class SoMaterialBinding;
 class SoIndexedLineSet;
+class SoCallback;
+class SoAction;
 
 namespace PartGui
 {
@@ -64,6 +70,18 @@ namespace PartGui
 class SoBrepFaceSet;
 class SoBrepEdgeSet;
 class SoBrepPointSet;
+class TessellationScheduler;
+
+/// The tessellation of a shape in the layout of the Coin nodes of SoFCShape
+struct PartGuiExport CoinGeometry
+{
+    std::vector<SbVec3f> points;
+    std::vector<SbVec3f> normals;
+    std::vector<int32_t> faceIndices;
+    std::vector<int32_t> partIndices;
+    std::vector<int32_t> lineIndices;
+    int pointStart {0};
+};
 
 class PartGuiExport ViewProviderPartExt: public Gui::ViewProviderGeometryObject
 {
@@ -200,6 +218,27 @@ public:
         bool normalsFromUV = false
     );
 
+    /** Tessellates the shape and computes the data of the Coin nodes.
+     * No Coin node is touched, so this can run on a worker thread as long as
+     * no other thread meshes a shape that shares sub-shapes with \a shape.
+     */
+    static CoinGeometry buildCoinGeometry(
+        TopoDS_Shape shape,
+        double deviation,
+        double angularDeflection,
+        bool normalsFromUV = false
+    );
+
+    /// copies the tessellation to the Coin nodes
+    static void applyCoinGeometry(
+        const CoinGeometry& geometry,
+        SoCoordinate3* coords,
+        SoBrepFaceSet* faceset,
+        SoNormal* norm,
+        SoBrepEdgeSet* lineset,
+        SoBrepPointSet* nodeset
+    );
+
 protected:
     bool setEdit(int ModNum) override;
     void unsetEdit(int ModNum) override;
@@ -210,6 +249,8 @@ protected:
     void onChanged(const App::Property* prop) override;
     bool loadParameter();
     void updateVisual();
+    /// replaces the scene graph of \a shape, keeps the old one if \a geometry is null
+    void updateVisual(const TopoDS_Shape& shape, const CoinGeometry* geometry, int level = 0);
     void handleChangedPropertyName(
         Base::XMLReader& reader,
         const char* TypeName,
@@ -253,6 +294,22 @@ private:
 
     // shape that was last rendered so if it does not change we don't re-render it without need
     TopoDS_Shape lastRenderedShape;
+
+    /** @name Level of detail
+     * While a coarse tessellation is rendered a callback node measures the size of the
+     * shape on screen and requests a finer level from the TessellationScheduler.
+     */
+    //@{
+    static void levelOfDetailCallback(void* data, SoAction* action);
+    void setRenderedLevel(int level, const CoinGeometry& geometry);
+
+    SoCallback* pcLevelOfDetail;
+    SbBox3f levelBoundBox;
+    int renderedLevel = 0;
+    int requestedLevel = 0;
+    //@}
+
+    friend class TessellationScheduler;
 };
 
 }  // namespace PartGui
@@ -22,6 +22,7 @@
  *                                                                         *
  ***************************************************************************/
 
+#include <algorithm>
 #include <memory>
 
 
@@ -75,6 +76,28 @@ private:
 
         return std::make_tuple(useColor, checkState, minDistance);
     }
+    void applyImportSettings(Reader& reader) const
+    {
+        Base::Reference<ParameterGrp> hGrp = App::GetApplication()
+                                                 .GetUserParameter()
+                                                 .GetGroup("BaseApp")
+                                                 ->GetGroup("Preferences")
+                                                 ->GetGroup("Mod/Points/Import");
+        // keep only every n-th point and, optionally, the points inside a box
+        long step = hGrp->GetInt("Step", 1);
+        reader.setStep(static_cast<std::size_t>(std::max(step, 1L)));
+        if (hGrp->GetBool("UseCropBox", false)) {
+            Base::BoundBox3d box(
+                hGrp->GetFloat("CropXMin"),
+                hGrp->GetFloat("CropYMin"),
+                hGrp->GetFloat("CropZMin"),
+                hGrp->GetFloat("CropXMax"),
+                hGrp->GetFloat("CropYMax"),
+                hGrp->GetFloat("CropZMax")
+            );
+            reader.setBoundBox(box);
+        }
+    }
     Py::Object open(const Py::Tuple& args)
     {
         char* Name {};
@@ -115,6 +138,7 @@ private:
                 throw Py::RuntimeError("Unsupported file extension");
             }
 
+            applyImportSettings(*reader);
             reader->read(EncodedName);
 
             App::Document* pcDoc = App::GetApplication().newDocument();
@@ -242,6 +266,7 @@ private:
                 throw Py::RuntimeError("Unsupported file extension");
             }
 
+            applyImportSettings(*reader);
             reader->read(EncodedName);
 
             App::Document* pcDoc = App::GetApplication().getDocument(DocName);
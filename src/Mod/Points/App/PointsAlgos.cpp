@@ -48,6 +48,12 @@
 
 using namespace Points;
 
+namespace
+{
+// Number of points that the PLY and PCD readers read at once
+constexpr Eigen::Index readBlockSize = 1 << 20;
+}  // namespace
+
 void PointsAlgos::Load(PointKernel& points, const char* FileName)
 {
     Base::FileInfo File(FileName);
@@ -196,6 +202,86 @@ int Reader::getHeight() const
     return height;
 }
 
+void Reader::setStep(std::size_t s)
+{
+    step = std::max<std::size_t>(s, 1);
+}
+
+std::size_t Reader::getStep() const
+{
+    return step;
+}
+
+void Reader::setBoundBox(const Base::BoundBox3d& box)
+{
+    boundBox = box;
+}
+
+const Base::BoundBox3d& Reader::getBoundBox() const
+{
+    return boundBox;
+}
+
+bool Reader::keepsAllPoints() const
+{
+    return step == 1 && !boundBox.IsValid();
+}
+
+bool Reader::keepPoint(std::size_t index, const Base::Vector3d& pnt) const
+{
+    if (index % step != 0) {
+        return false;
+    }
+
+    return !boundBox.IsValid() || boundBox.IsInBox(pnt);
+}
+
+void Reader::filterPoints()
+{
+    if (keepsAllPoints()) {
+        return;
+    }
+
+    std::size_t numPoints = points.size();
+    bool hasIntensity = intensity.size() == numPoints;
+    bool hasColor = colors.size() == numPoints;
+    bool hasNormal = normals.size() == numPoints;
+
+    std::size_t count = 0;
+    for (std::size_t index = 0; index < numPoints; index++) {
+        Base::Vector3d pnt = points.getPoint(int(index));
+        if (!keepPoint(index, pnt)) {
+            continue;
+        }
+
+        points.setPoint(int(count), pnt);
+        if (hasIntensity) {
+            intensity[count] = intensity[index];
+        }
+        if (hasColor) {
+            colors[count] = colors[index];
+        }
+        if (hasNormal) {
+            normals[count] = normals[index];
+        }
+        count++;
+    }
+
+    points.resize(count);
+    if (hasIntensity) {
+        intensity.resize(count);
+    }
+    if (hasColor) {
+        colors.resize(count);
+    }
+    if (hasNormal) {
+        normals.resize(count);
+    }
+
+    this->width = static_cast<int>(count);
+    this->height = 1;
+}
+
 // ----------------------------------------------------------------------------
 
 AscReader::AscReader() = default;
@@ -205,6 +291,7 @@ void AscReader::read(const std::string& filename)
     points.load(filename.c_str());
     this->height = 1;
     this->width = points.size();
+    filterPoints();
 }
 
 // ----------------------------------------------------------------------------
@@ -573,21 +660,45 @@ void PlyReader::read(const std::string& filename)
     std::size_t offset = 0;
     Eigen::Index numPoints = Eigen::Index(readHeader(inp, format, offset, fields, types, sizes));
 
-    this->width = numPoints;
-    this->height = 1;
+    // The data is read and transferred in blocks so that only the points that are kept
+    // must be held in memory
+    Eigen::Index blockSize = std::min<Eigen::Index>(numPoints, readBlockSize);
+    Eigen::MatrixXd data(blockSize, fields.size());
+    for (Eigen::Index first = 0; first < numPoints; first += blockSize) {
+        if (numPoints - first < blockSize) {
+            data.resize(numPoints - first, Eigen::NoChange);
+        }
 
-    Eigen::MatrixXd data(numPoints, fields.size());
-    if (format == "ascii") {
-        readAscii(inp, offset, data);
-    }
-    else if (format == "binary_little_endian") {
-        readBinary(false, inp, offset, types, sizes, data);
-    }
-    else if (format == "binary_big_endian") {
-        readBinary(true, inp, offset, types, sizes, data);
+        // the elements before the vertices are only skipped once
+        std::size_t skip = first == 0 ? offset : 0;
+        if (format == "ascii") {
+            readAscii(inp, skip, data);
+        }
+        else if (format == "binary_little_endian") {
+            readBinary(false, inp, skip, types, sizes, data);
+        }
+        else if (format == "binary_big_endian") {
+            readBinary(true, inp, skip, types, sizes, data);
+        }
+        else {
+            break;
+        }
+
+        addPoints(data, first, fields, types);
     }
 
-    std::vector<std::string>::iterator it;
+    this->width = keepsAllPoints() ? numPoints : static_cast<int>(points.size());
+    this->height = 1;
+}
+
+void PlyReader::addPoints(
+    const Eigen::MatrixXd& data,
+    std::size_t first,
+    const std::vector<std::string>& fields,
+    const std::vector<std::string>& types
+)
+{
+    std::vector<std::string>::const_iterator it;
     Eigen::Index max_size = std::numeric_limits<Eigen::Index>::max();
 
     // x field
@@ -678,57 +789,57 @@ void PlyReader::read(const std::string& filename)
     bool hasNormal = (normal_x != max_size && normal_y != max_size && normal_z != max_size);
     bool hasIntensity = (greyvalue != max_size);
     bool hasColor = (red != max_size && green != max_size && blue != max_size);
+    bool hasUCharColor = hasColor && types[red] == "uchar";
+    bool hasFloatColor = hasColor && types[red] == "float";
 
-    if (hasData) {
-        points.reserve(numPoints);
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            points.push_back(Base::Vector3d(data(i, x), data(i, y), data(i, z)));
-        }
+    if (!hasData) {
+        return;
     }
 
-    if (hasData && hasNormal) {
-        normals.reserve(numPoints);
-        for (Eigen::Index i = 0; i < numPoints; i++) {
+    Eigen::Index numPoints = data.rows();
+    if (keepsAllPoints()) {
+        points.reserve(points.size() + numPoints);
+    }
+
+    for (Eigen::Index i = 0; i < numPoints; i++) {
+        Base::Vector3d pnt(data(i, x), data(i, y), data(i, z));
+        if (!keepPoint(first + i, pnt)) {
+            continue;
+        }
+
+        points.push_back(pnt);
+
+        if (hasNormal) {
             normals.emplace_back(data(i, normal_x), data(i, normal_y), data(i, normal_z));
         }
-    }
 
-    if (hasData && hasIntensity) {
-        intensity.reserve(numPoints);
-        for (Eigen::Index i = 0; i < numPoints; i++) {
+        if (hasIntensity) {
             intensity.push_back(static_cast<float>(data(i, greyvalue)));
         }
-    }
 
-    if (hasData && hasColor) {
-        colors.reserve(numPoints);
-        float a = 1.0;
-        if (types[red] == "uchar") {
-            for (Eigen::Index i = 0; i < numPoints; i++) {
-                float r = static_cast<float>(data(i, red));
-                float g = static_cast<float>(data(i, green));
-                float b = static_cast<float>(data(i, blue));
-                if (alpha != max_size) {
-                    a = static_cast<float>(data(i, alpha));
-                }
-                colors.emplace_back(
-                    static_cast<float>(r) / 255.0F,
-                    static_cast<float>(g) / 255.0F,
-                    static_cast<float>(b) / 255.0F,
-                    static_cast<float>(a) / 255.0F
-                );
+        if (hasUCharColor) {
+            float a = 1.0F;
+            if (alpha != max_size) {
+                a = static_cast<float>(data(i, alpha));
             }
+            colors.emplace_back(
+                static_cast<float>(data(i, red)) / 255.0F,
+                static_cast<float>(data(i, green)) / 255.0F,
+                static_cast<float>(data(i, blue)) / 255.0F,
+                a / 255.0F
+            );
         }
-        else if (types[red] == "float") {
-            for (Eigen::Index i = 0; i < numPoints; i++) {
-                float r = static_cast<float>(data(i, red));
-                float g = static_cast<float>(data(i, green));
-                float b = static_cast<float>(data(i, blue));
-                if (alpha != max_size) {
-                    a = static_cast<float>(data(i, alpha));
-                }
-                colors.emplace_back(r, g, b, a);
+        else if (hasFloatColor) {
+            float a = 1.0F;
+            if (alpha != max_size) {
+                a = static_cast<float>(data(i, alpha));
             }
+            colors.emplace_back(
+                static_cast<float>(data(i, red)),
+                static_cast<float>(data(i, green)),
+                static_cast<float>(data(i, blue)),
+                a
+            );
         }
     }
 }
@@ -912,7 +1023,7 @@ void PlyReader::readAscii(std::istream& inp, std::size_t offset, Eigen::MatrixXd
     Eigen::Index numPoints = Eigen::Index(data.rows());
     Eigen::Index numFields = Eigen::Index(data.cols());
     std::vector<std::string> list;
-    while (std::getline(inp, line) && row < numPoints) {
+    while (row < numPoints && std::getline(inp, line)) {
         if (line.empty()) {
             continue;
         }
@@ -1056,14 +1167,29 @@ void PcdReader::read(const std::string& filename)
     std::vector<int> sizes;
     Eigen::Index numPoints = Eigen::Index(readHeader(inp, format, fields, types, sizes));
 
-    Eigen::MatrixXd data(numPoints, fields.size());
-    if (format == "ascii") {
-        readAscii(inp, data);
-    }
-    else if (format == "binary") {
-        readBinary(false, inp, types, sizes, data);
+    if (format == "ascii" || format == "binary") {
+        // The data is read and transferred in blocks so that only the points that are kept
+        // must be held in memory
+        Eigen::Index blockSize = std::min<Eigen::Index>(numPoints, readBlockSize);
+        Eigen::MatrixXd data(blockSize, fields.size());
+        for (Eigen::Index first = 0; first < numPoints; first += blockSize) {
+            if (numPoints - first < blockSize) {
+                data.resize(numPoints - first, Eigen::NoChange);
+            }
+
+            if (format == "ascii") {
+                readAscii(inp, data);
+            }
+            else {
+                readBinary(false, inp, types, sizes, data);
+            }
+
+            addPoints(data, first, fields, types);
+        }
     }
     else if (format == "binary_compressed") {
+        // the data is stored field by field and thus must be read as a whole
+        Eigen::MatrixXd data(numPoints, fields.size());
         unsigned int c {};
         unsigned int u {};
         Base::InputStream str(inp);
@@ -1081,9 +1207,25 @@ void PcdReader::read(const std::string& filename)
         else {
             throw Base::BadFormatError("Failed to decompress binary data");
         }
+
+        addPoints(data, 0, fields, types);
     }
 
-    std::vector<std::string>::iterator it;
+    // a filtered point cloud has lost its structure
+    if (!keepsAllPoints()) {
+        this->width = static_cast<int>(points.size());
+        this->height = 1;
+    }
+}
+
+void PcdReader::addPoints(
+    const Eigen::MatrixXd& data,
+    std::size_t first,
+    const std::vector<std::string>& fields,
+    const std::vector<std::string>& types
+)
+{
+    std::vector<std::string>::const_iterator it;
     Eigen::Index max_size = std::numeric_limits<Eigen::Index>::max();
 
     // x field
@@ -1159,48 +1301,48 @@ void PcdReader::read(const std::string& filename)
     bool hasNormal = (normal_x != max_size && normal_y != max_size && normal_z != max_size);
     bool hasIntensity = (greyvalue != max_size);
     bool hasColor = (rgba != max_size);
+    bool hasPackedColor = hasColor && types[rgba] == "U";
+    bool hasFloatColor = hasColor && types[rgba] == "F";
 
-    if (hasData) {
-        points.reserve(numPoints);
-        for (Eigen::Index i = 0; i < numPoints; i++) {
-            points.push_back(Base::Vector3d(data(i, x), data(i, y), data(i, z)));
-        }
+    if (!hasData) {
+        return;
     }
 
-    if (hasData && hasNormal) {
-        normals.reserve(numPoints);
-        for (Eigen::Index i = 0; i < numPoints; i++) {
+    Eigen::Index numPoints = data.rows();
+    if (keepsAllPoints()) {
+        points.reserve(points.size() + numPoints);
+    }
+
+    static_assert(sizeof(float) == sizeof(uint32_t), "float and uint32_t have different sizes");
+    for (Eigen::Index i = 0; i < numPoints; i++) {
+        Base::Vector3d pnt(data(i, x), data(i, y), data(i, z));
+        if (!keepPoint(first + i, pnt)) {
+            continue;
+        }
+
+        points.push_back(pnt);
+
+        if (hasNormal) {
             normals.emplace_back(data(i, normal_x), data(i, normal_y), data(i, normal_z));
         }
-    }
 
-    if (hasData && hasIntensity) {
-        intensity.reserve(numPoints);
-        for (Eigen::Index i = 0; i < numPoints; i++) {
+        if (hasIntensity) {
             intensity.push_back(data(i, greyvalue));
         }
-    }
 
-    if (hasData && hasColor) {
-        colors.reserve(numPoints);
-        if (types[rgba] == "U") {
-            for (Eigen::Index i = 0; i < numPoints; i++) {
-                uint32_t packed = static_cast<uint32_t>(data(i, rgba));
-                Base::Color col;
-                col.setPackedARGB(packed);
-                colors.emplace_back(col);
-            }
+        if (hasPackedColor) {
+            uint32_t packed = static_cast<uint32_t>(data(i, rgba));
+            Base::Color col;
+            col.setPackedARGB(packed);
+            colors.emplace_back(col);
         }
-        else if (types[rgba] == "F") {
-            static_assert(sizeof(float) == sizeof(uint32_t), "float and uint32_t have different sizes");
-            for (Eigen::Index i = 0; i < numPoints; i++) {
-                float f = static_cast<float>(data(i, rgba));
-                uint32_t packed {};
-                std::memcpy(&packed, &f, sizeof(packed));
-                Base::Color col;
-                col.setPackedARGB(packed);
-                colors.emplace_back(col);
-            }
+        else if (hasFloatColor) {
+            float f = static_cast<float>(data(i, rgba));
+            uint32_t packed {};
+            std::memcpy(&packed, &f, sizeof(packed));
+            Base::Color col;
+            col.setPackedARGB(packed);
+            colors.emplace_back(col);
         }
     }
 }
@@ -1285,7 +1427,7 @@ void PcdReader::readAscii(std::istream& inp, Eigen::MatrixXd& data)
     Eigen::Index numPoints = data.rows();
     Eigen::Index numFields = data.cols();
     std::vector<std::string> list;
-    while (std::getline(inp, line) && row < numPoints) {
+    while (row < numPoints && std::getline(inp, line)) {
         if (line.empty()) {
             continue;
         }
@@ -1892,6 +2034,7 @@ void E57Reader::read(const std::string& filename)
         intensity = reader.getItensity();
         width = points.size();
         height = 1;
+        filterPoints();
     }
     catch (const Base::BadFormatError&) {
         throw;
@@ -26,6 +26,8 @@
 
 #include <Eigen/Core>
 
+#include <Base/BoundBox.h>
+
 #include "Points.h"
 #include "Properties.h"
 
@@ -66,12 +68,29 @@ public:
     int getWidth() const;
     int getHeight() const;
 
+    /** Keeps only every \a step-th point of the file. With a step of 1, the default, all
+     * points are kept. The points are filtered while reading, so with a larger step a
+     * point cloud that doesn't fit into memory as a whole can be read in decimated form.
+     */
+    void setStep(std::size_t step);
+    std::size_t getStep() const;
+    /** Keeps only the points inside \a box. An invalid box, the default, keeps all points. */
+    void setBoundBox(const Base::BoundBox3d& box);
+    const Base::BoundBox3d& getBoundBox() const;
+
     Reader(const Reader&) = delete;
     Reader(Reader&&) = delete;
     Reader& operator=(const Reader&) = delete;
     Reader& operator=(Reader&&) = delete;
 
 protected:
+    /** Returns true if no points are filtered out while reading. */
+    bool keepsAllPoints() const;
+    /** Returns true if the point \a pnt with the position \a index in the file passes the filter. */
+    bool keepPoint(std::size_t index, const Base::Vector3d& pnt) const;
+    /** Applies the filter to points that have been read completely before. */
+    void filterPoints();
+
     // NOLINTBEGIN
     PointKernel points;
     std::vector<float> intensity;
@@ -79,6 +98,8 @@ protected:
     std::vector<Base::Vector3f> normals;
     int width {0};
     int height {1};
+    std::size_t step {1};
+    Base::BoundBox3d boundBox;
     // NOLINTEND
 };
 
@@ -96,6 +117,12 @@ public:
     void read(const std::string& filename) override;
 
 private:
+    void addPoints(
+        const Eigen::MatrixXd& data,
+        std::size_t first,
+        const std::vector<std::string>& fields,
+        const std::vector<std::string>& types
+    );
     std::size_t readHeader(
         std::istream&,
         std::string& format,
@@ -122,6 +149,12 @@ public:
     void read(const std::string& filename) override;
 
 private:
+    void addPoints(
+        const Eigen::MatrixXd& data,
+        std::size_t first,
+        const std::vector<std::string>& fields,
+        const std::vector<std::string>& types
+    );
     std::size_t readHeader(
         std::istream&,
         std::string& format,
@@ -0,0 +1,386 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/****************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL               *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#include <algorithm>
+#include <future>
+#include <thread>
+
+#include <Eigen/Eigenvalues>
+
+#include <Base/BoundBox.h>
+
+#include "Points.h"
+#include "PointsKDTree.h"
+
+
+using namespace Points;
+
+namespace
+{
+// Ranges with at most this number of points are searched linearly
+constexpr std::size_t leafSize = 8;
+// Minimum number of points per thread when building the tree or searching in parallel
+constexpr std::size_t minChunkSize = 10000;
+
+double coord(const Base::Vector3d& pnt, unsigned char axis)
+{
+    return axis == 0 ? pnt.x : (axis == 1 ? pnt.y : pnt.z);
+}
+
+// Number of tree levels whose halves are built in separate threads, so that at most
+// as many threads as the hardware supports are running at the same time
+int parallelBuildDepth()
+{
+    unsigned int threads = std::max(1U, std::thread::hardware_concurrency());
+    int depth = 0;
+    while ((1U << depth) < threads) {
+        depth++;
+    }
+    return depth;
+}
+
+// Calls func(begin, end) for contiguous chunks of [0, size) in several threads
+template<class Func>
+void parallelFor(std::size_t size, Func func)
+{
+    std::size_t chunks = std::max(1U, std::thread::hardware_concurrency());
+    chunks = std::max<std::size_t>(1, std::min(chunks, size / minChunkSize));
+
+    std::vector<std::future<void>> futures;
+    for (std::size_t i = 1; i < chunks; i++) {
+        futures.push_back(
+            std::async(std::launch::async, func, i * size / chunks, (i + 1) * size / chunks)
+        );
+    }
+    func(std::size_t(0), size / chunks);
+    for (auto& future : futures) {
+        future.get();
+    }
+}
+}  // namespace
+
+struct PointsKDTree::Neighbour
+{
+    double distance;
+    std::size_t index;
+
+    bool operator<(const Neighbour& other) const
+    {
+        return distance < other.distance;
+    }
+};
+
+PointsKDTree::PointsKDTree(const PointKernel& kernel)
+{
+    points.reserve(kernel.size());
+    for (const auto& pnt : kernel) {
+        points.push_back(pnt);
+    }
+
+    order.resize(points.size());
+    axes.resize(points.size());
+    for (std::size_t i = 0; i < order.size(); i++) {
+        order[i] = i;
+    }
+    Build(0, order.size(), parallelBuildDepth());
+}
+
+PointsKDTree::PointsKDTree(std::vector<Base::Vector3d> pnts)
+    : points(std::move(pnts))
+{
+    order.resize(points.size());
+    axes.resize(points.size());
+    for (std::size_t i = 0; i < order.size(); i++) {
+        order[i] = i;
+    }
+    Build(0, order.size(), parallelBuildDepth());
+}
+
+void PointsKDTree::Build(std::size_t first, std::size_t last, int depth)
+{
+    if (last - first <= leafSize) {
+        return;
+    }
+
+    // split along the axis with the largest extent
+    Base::BoundBox3d box;
+    for (std::size_t i = first; i < last; i++) {
+        box.Add(points[order[i]]);
+    }
+    double lenX = box.LengthX();
+    double lenY = box.LengthY();
+    double lenZ = box.LengthZ();
+    unsigned char axis = 2;
+    if (lenX >= lenY && lenX >= lenZ) {
+        axis = 0;
+    }
+    else if (lenY >= lenZ) {
+        axis = 1;
+    }
+
+    std::size_t mid = first + (last - first) / 2;
+    std::nth_element(
+        order.begin() + std::ptrdiff_t(first),
+        order.begin() + std::ptrdiff_t(mid),
+        order.begin() + std::ptrdiff_t(last),
+        [this, axis](std::size_t lhs, std::size_t rhs) {
+            return coord(points[lhs], axis) < coord(points[rhs], axis);
+        }
+    );
+    axes[mid] = axis;
+
+    // the two halves are independent of each other
+    if (depth > 0 && last - first > 2 * minChunkSize) {
+        auto future =
+            std::async(std::launch::async, &PointsKDTree::Build, this, first, mid, depth - 1);
+        Build(mid + 1, last, depth - 1);
+        future.get();
+    }
+    else {
+        Build(first, mid, 0);
+        Build(mid + 1, last, 0);
+    }
+}
+
+std::size_t PointsKDTree::Size() const
+{
+    return points.size();
+}
+
+const Base::Vector3d& PointsKDTree::GetPoint(std::size_t index) const
+{
+    return points[index];
+}
+
+void PointsKDTree::FindNearest(
+    const Base::Vector3d& pnt,
+    std::size_t k,
+    std::vector<std::size_t>& indices
+) const
+{
+    indices.clear();
+    if (k == 0) {
+        return;
+    }
+
+    // max-heap of the k nearest points found so far
+    std::vector<Neighbour> heap;
+    heap.reserve(k + 1);
+    SearchNearest(0, order.size(), pnt, k, heap);
+
+    std::sort_heap(heap.begin(), heap.end());
+    indices.reserve(heap.size());
+    for (const auto& it : heap) {
+        indices.push_back(it.index);
+    }
+}
+
+std::vector<std::vector<std::size_t>> PointsKDTree::FindNearest(
+    const std::vector<Base::Vector3d>& pnts,
+    std::size_t k
+) const
+{
+    std::vector<std::vector<std::size_t>> result(pnts.size());
+    parallelFor(pnts.size(), [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            FindNearest(pnts[i], k, result[i]);
+        }
+    });
+    return result;
+}
+
+void PointsKDTree::SearchNearest(
+    std::size_t first,
+    std::size_t last,
+    const Base::Vector3d& pnt,
+    std::size_t k,
+    std::vector<Neighbour>& heap
+) const
+{
+    auto check = [&](std::size_t index) {
+        double dist = Base::DistanceP2(pnt, points[index]);
+        if (heap.size() < k) {
+            heap.push_back({dist, index});
+            std::push_heap(heap.begin(), heap.end());
+        }
+        else if (dist < heap.front().distance) {
+            std::pop_heap(heap.begin(), heap.end());
+            heap.back() = {dist, index};
+            std::push_heap(heap.begin(), heap.end());
+        }
+    };
+
+    if (last - first <= leafSize) {
+        for (std::size_t i = first; i < last; i++) {
+            check(order[i]);
+        }
+        return;
+    }
+
+    std::size_t mid = first + (last - first) / 2;
+    std::size_t node = order[mid];
+    check(node);
+
+    double diff = coord(pnt, axes[mid]) - coord(points[node], axes[mid]);
+    if (diff < 0) {
+        SearchNearest(first, mid, pnt, k, heap);
+        if (heap.size() < k || diff * diff < heap.front().distance) {
+            SearchNearest(mid + 1, last, pnt, k, heap);
+        }
+    }
+    else {
+        SearchNearest(mid + 1, last, pnt, k, heap);
+        if (heap.size() < k || diff * diff < heap.front().distance) {
+            SearchNearest(first, mid, pnt, k, heap);
+        }
+    }
+}
+
+void PointsKDTree::FindInRange(
+    const Base::Vector3d& pnt,
+    double radius,
+    std::vector<std::size_t>& indices
+) const
+{
+    indices.clear();
+    SearchInRange(0, order.size(), pnt, radius, indices);
+}
+
+std::vector<std::vector<std::size_t>> PointsKDTree::FindInRange(
+    const std::vector<Base::Vector3d>& pnts,
+    double radius
+) const
+{
+    std::vector<std::vector<std::size_t>> result(pnts.size());
+    parallelFor(pnts.size(), [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i++) {
+            FindInRange(pnts[i], radius, result[i]);
+        }
+    });
+    return result;
+}
+
+void PointsKDTree::SearchInRange(
+    std::size_t first,
+    std::size_t last,
+    const Base::Vector3d& pnt,
+    double radius,
+    std::vector<std::size_t>& indices
+) const
+{
+    double radius2 = radius * radius;
+    if (last - first <= leafSize) {
+        for (std::size_t i = first; i < last; i++) {
+            if (Base::DistanceP2(pnt, points[order[i]]) <= radius2) {
+                indices.push_back(order[i]);
+            }
+        }
+        return;
+    }
+
+    std::size_t mid = first + (last - first) / 2;
+    std::size_t node = order[mid];
+    if (Base::DistanceP2(pnt, points[node]) <= radius2) {
+        indices.push_back(node);
+    }
+
+    double diff = coord(pnt, axes[mid]) - coord(points[node], axes[mid]);
+    if (diff <= radius) {
+        SearchInRange(first, mid, pnt, radius, indices);
+    }
+    if (diff >= -radius) {
+        SearchInRange(mid + 1, last, pnt, radius, indices);
+    }
+}
+
+// ----------------------------------------------------------------------------
+
+NormalEstimation::NormalEstimation(const PointsKDTree& tree)
+    : tree(tree)
+{}
+
+void NormalEstimation::setKSearch(std::size_t k)
+{
+    kSearch = k;
+}
+
+void NormalEstimation::setSearchRadius(double radius)
+{
+    searchRadius = radius;
+}
+
+void NormalEstimation::perform(std::vector<Base::Vector3d>& normals) const
+{
+    std::vector<double> curvatures;
+    perform(normals, curvatures);
+}
+
+void NormalEstimation::perform(
+    std::vector<Base::Vector3d>& normals,
+    std::vector<double>& curvatures
+) const
+{
+    std::size_t numPoints = tree.Size();
+    normals.resize(numPoints);
+    curvatures.resize(numPoints);
+
+    parallelFor(numPoints, [&](std::size_t begin, std::size_t end) {
+        std::vector<std::size_t> neighbours;
+        for (std::size_t i = begin; i < end; i++) {
+            if (searchRadius > 0.0) {
+                tree.FindInRange(tree.GetPoint(i), searchRadius, neighbours);
+            }
+            else {
+                tree.FindNearest(tree.GetPoint(i), kSearch, neighbours);
+            }
+            if (neighbours.size() < 3) {
+                normals[i] = Base::Vector3d();
+                curvatures[i] = 0.0;
+                continue;
+            }
+
+            Eigen::Vector3d center = Eigen::Vector3d::Zero();
+            for (std::size_t index : neighbours) {
+                const Base::Vector3d& pnt = tree.GetPoint(index);
+                center += Eigen::Vector3d(pnt.x, pnt.y, pnt.z);
+            }
+            center /= double(neighbours.size());
+
+            Eigen::Matrix3d covariance = Eigen::Matrix3d::Zero();
+            for (std::size_t index : neighbours) {
+                const Base::Vector3d& pnt = tree.GetPoint(index);
+                Eigen::Vector3d diff = Eigen::Vector3d(pnt.x, pnt.y, pnt.z) - center;
+                covariance += diff * diff.transpose();
+            }
+
+            // the eigenvalues are sorted in increasing order
+            Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> solver(covariance);
+            Eigen::Vector3d normal = solver.eigenvectors().col(0);
+            Eigen::Vector3d values = solver.eigenvalues();
+            normals[i] = Base::Vector3d(normal.x(), normal.y(), normal.z());
+
+            double sum = values.sum();
+            curvatures[i] = sum > 0.0 ? values(0) / sum : 0.0;
+        }
+    });
+}
@@ -0,0 +1,131 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/****************************************************************************
+ *   Copyright (c) 2026 The FreeCAD Project Association AISBL               *
+ *                                                                          *
+ *   This file is part of FreeCAD.                                          *
+ *                                                                          *
+ *   FreeCAD is free software: you can redistribute it and/or modify it     *
+ *   under the terms of the GNU Lesser General Public License as            *
+ *   published by the Free Software Foundation, either version 2.1 of the   *
+ *   License, or (at your option) any later version.                        *
+ *                                                                          *
+ *   FreeCAD is distributed in the hope that it will be useful, but         *
+ *   WITHOUT ANY WARRANTY; without even the implied warranty of             *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU       *
+ *   Lesser General Public License for more details.                        *
+ *                                                                          *
+ *   You should have received a copy of the GNU Lesser General Public       *
+ *   License along with FreeCAD. If not, see                                *
+ *   <https://www.gnu.org/licenses/>.                                       *
+ *                                                                          *
+ ***************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include <Base/Vector3D.h>
+#include <Mod/Points/PointsGlobal.h>
+
+
+namespace Points
+{
+class PointKernel;
+
+/**
+ * The PointsKDTree class is a balanced kd-tree over the points of a point cloud.
+ * Other than the PointsGrid it adapts to the local density of the points, so the
+ * search times don't depend on how uniformly the points are distributed.
+ * The tree is immutable after construction, hence all search methods can be called
+ * from several threads at the same time.
+ */
+class PointsExport PointsKDTree
+{
+public:
+    /// Builds the tree for the points of \a kernel
+    explicit PointsKDTree(const PointKernel& kernel);
+    /// Builds the tree for \a points
+    explicit PointsKDTree(std::vector<Base::Vector3d> points);
+
+    /** Returns the number of points. */
+    std::size_t Size() const;
+    /** Returns the point with the given index. */
+    const Base::Vector3d& GetPoint(std::size_t index) const;
+    /** Searches for the \a k nearest points of \a pnt. The indices are sorted by
+     * increasing distance.
+     */
+    void FindNearest(const Base::Vector3d& pnt, std::size_t k, std::vector<std::size_t>& indices) const;
+    /** Searches for the \a k nearest points of each of \a pnts concurrently. */
+    std::vector<std::vector<std::size_t>> FindNearest(
+        const std::vector<Base::Vector3d>& pnts,
+        std::size_t k
+    ) const;
+    /** Searches for all points with a distance of at most \a radius to \a pnt. The indices
+     * are not sorted.
+     */
+    void FindInRange(const Base::Vector3d& pnt, double radius, std::vector<std::size_t>& indices) const;
+    /** Searches for the points in range of each of \a pnts concurrently. */
+    std::vector<std::vector<std::size_t>> FindInRange(
+        const std::vector<Base::Vector3d>& pnts,
+        double radius
+    ) const;
+
+private:
+    struct Neighbour;
+    void Build(std::size_t first, std::size_t last, int depth);
+    void SearchNearest(
+        std::size_t first,
+        std::size_t last,
+        const Base::Vector3d& pnt,
+        std::size_t k,
+        std::vector<Neighbour>& heap
+    ) const;
+    void SearchInRange(
+        std::size_t first,
+        std::size_t last,
+        const Base::Vector3d& pnt,
+        double radius,
+        std::vector<std::size_t>& indices
+    ) const;
+
+private:
+    std::vector<Base::Vector3d> points;
+    /// The point indices in tree order: the median of a range is the node of its sub-tree
+    std::vector<std::size_t> order;
+    /// The split axis of the node at the same position in 'order'
+    std::vector<unsigned char> axes;
+};
+
+/**
+ * The NormalEstimation class estimates the normal and the surface variation at each point
+ * of a point cloud by fitting a plane to its k nearest neighbours.
+ * The orientation of the normals is arbitrary.
+ */
+class PointsExport NormalEstimation
+{
+public:
+    explicit NormalEstimation(const PointsKDTree& tree);
+
+    /** Sets the number of nearest neighbours to use. The default is 10. */
+    void setKSearch(std::size_t k);
+    /** Uses all points within \a radius as neighbours instead of the k nearest ones if
+     * \a radius is positive. The default is 0.
+     */
+    void setSearchRadius(double radius);
+    /** Computes the normals of all points concurrently. */
+    void perform(std::vector<Base::Vector3d>& normals) const;
+    /** Computes the normals and the surface variation of all points concurrently. The
+     * surface variation is the smallest eigenvalue of the covariance matrix divided by the
+     * sum of all eigenvalues: zero for a plane and 1/3 for an isotropic distribution.
+     */
+    void perform(std::vector<Base::Vector3d>& normals, std::vector<double>& curvatures) const;
+
+private:
+    const PointsKDTree& tree;
+    std::size_t kSearch {10};
+    double searchRadius {0.0};
+};
+
+}  // namespace Points
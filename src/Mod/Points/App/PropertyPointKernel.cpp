@@ -26,6 +26,7 @@
 #include <algorithm>
 #include <cmath>
 #include <iostream>
+#include <memory>
 
 
 #include <Base/Matrix.h>
@@ -133,6 +134,22 @@ void PropertyPointKernel::RestoreDocFile(Base::Reader& reader)
     hasSetValue();
 }
 
+bool PropertyPointKernel::canDecodeDocFile() const
+{
+    return true;
+}
+
+std::function<void()> PropertyPointKernel::decodeDocFile(Base::Reader& reader)
+{
+    auto points = std::make_shared<PointKernel>();
+    points->RestoreDocFile(reader);
+    return [this, points]() {
+        aboutToSetValue();
+        _cPoints->swap(points->getBasicPoints());
+        hasSetValue();
+    };
+}
+
 App::Property* PropertyPointKernel::Copy() const
 {
     PropertyPointKernel* prop = new PropertyPointKernel();
@@ -77,6 +77,8 @@ public:
     void Restore(Base::XMLReader& reader) override;
     void SaveDocFile(Base::Writer& writer) const override;
     void RestoreDocFile(Base::Reader& reader) override;
+    bool canDecodeDocFile() const override;
+    std::function<void()> decodeDocFile(Base::Reader& reader) override;
     //@}
 
     /** @name Modification */
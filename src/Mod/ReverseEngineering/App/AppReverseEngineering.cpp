@@ -34,6 +34,7 @@
 #include <Base/PyWrapParseTupleAndKeywords.h>
 #include <Mod/Mesh/App/MeshPy.h>
 #include <Mod/Part/App/BSplineSurfacePy.h>
+#include <Mod/Points/App/PointsKDTree.h>
 #include <Mod/Points/App/PointsPy.h>
 #if defined(HAVE_PCL_FILTERS)
 # include <pcl/filters/passthrough.h>
@@ -143,6 +144,13 @@ public:
             "f.ViewObject.Proxy=0\n"
             "f.ViewObject.DisplayMode=1\n"
         );
+#else
+        add_keyword_method("normalEstimation",&Module::normalEstimation,
+            "normalEstimation(Points,[KSearch=10, SearchRadius=0]) -> Normals\n"
+            "KSearch is an int and used to search the k-nearest neighbours in\n"
+            "the k-d tree. Alternatively, SearchRadius (a float) can be used\n"
+            "as spatial distance to determine the neighbours of a point\n"
+        );
 #endif
 #if defined(HAVE_PCL_SEGMENTATION)
         add_keyword_method("regionGrowingSegmentation",&Module::regionGrowingSegmentation,
@@ -824,6 +832,38 @@ Mesh.show(m)
             list.append(Py::Vector(*it));
         }
 
+        return list;
+    }
+#else
+    Py::Object normalEstimation(const Py::Tuple& args, const Py::Dict& kwds)
+    {
+        PyObject *pts;
+        int ksearch=0;
+        double searchRadius=0;
+
+        static const std::array<const char*,4> kwds_normals {"Points", "KSearch", "SearchRadius", NULL};
+        if (!Base::Wrapped_ParseTupleAndKeywords(args.ptr(), kwds.ptr(), "O!|id", kwds_normals,
+                                        &(Points::PointsPy::Type), &pts,
+                                        &ksearch, &searchRadius))
+            throw Py::Exception();
+
+        Points::PointKernel* points = static_cast<Points::PointsPy*>(pts)->getPointKernelPtr();
+
+        // without PCL use the k-d tree of the Points module
+        std::vector<Base::Vector3d> normals;
+        Points::PointsKDTree tree(*points);
+        Points::NormalEstimation estimate(tree);
+        if (ksearch > 0) {
+            estimate.setKSearch(ksearch);
+        }
+        estimate.setSearchRadius(searchRadius);
+        estimate.perform(normals);
+
+        Py::List list;
+        for (std::vector<Base::Vector3d>::iterator it = normals.begin(); it != normals.end(); ++it) {
+            list.append(Py::Vector(*it));
+        }
+
         return list;
     }
 #endif
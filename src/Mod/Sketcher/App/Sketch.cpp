@@ -4997,7 +4997,9 @@ int Sketch::internalSolve(std::string& solvername, int level)
 
     if (isInitMove) {
         solvername = "DogLeg";  // DogLeg is used for dragging (same as before)
-        ret = GCSsys.solve(isFine, GCS::DogLeg);
+        // each step of a drag starts from the solution of the previous one, keeping the
+        // partition and factorizations set up by initMove
+        ret = GCSsys.solveIncremental(isFine, GCS::DogLeg);
     }
     else {
         switch (defaultSolver) {
@@ -49,10 +49,13 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <future>
 #include <iostream>
 #include <limits>
 #include <numbers>
+#include <numeric>
+#include <thread>
 
 #include "GCS.h"
 #include "qp_eq.h"
@@ -488,6 +491,7 @@ System::System()
     , qrAlgorithm(EigenSparseQR)
     , autoChooseAlgorithm(true)
     , autoQRThreshold(1000)
+    , autoSparseThreshold(500)
     , dogLegGaussStep(FullPivLU)
     , qrpivotThreshold(1E-13)
     , debugMode(Minimal)
@@ -1855,6 +1859,7 @@ void System::initSolution(Algorithm alg)
     clearSubSystems();
     subSystems.resize(clists.size(), nullptr);
     subSystemsAux.resize(clists.size(), nullptr);
+    solvedComponents.assign(clists.size(), false);
     for (std::size_t cid = 0; cid < clists.size(); ++cid) {
         std::vector<Constraint*> clist0, clist1;
         std::ranges::partition_copy(
@@ -1902,31 +1907,126 @@ int System::solve(VEC_pD& params, bool isFine, Algorithm alg, bool isRedundantso
     return solve(isFine, alg, isRedundantsolving);
 }
 
+namespace
+{
+
+// below this number of parameters, starting threads costs more than solving the components
+constexpr int minConcurrentParameters = 64;
+
+// calls task(i) for every i in [0, count), distributing the calls over the available cores
+template<typename Task>
+void concurrentFor(int count, const Task& task)
+{
+    int workers = std::min<int>(count, std::max(1U, std::thread::hardware_concurrency()));
+    std::atomic<int> next {0};
+    auto work = [&next, &task, count]() {
+        for (int i = next++; i < count; i = next++) {
+            task(i);
+        }
+    };
+
+    std::vector<std::future<void>> futures;
+    futures.reserve(workers);
+    for (int i = 1; i < workers; ++i) {
+        futures.push_back(std::async(std::launch::async, work));
+    }
+    work();
+    for (auto& future : futures) {
+        future.get();
+    }
+}
+
+}  // namespace
+
 int System::solve(bool isFine, Algorithm alg, bool isRedundantsolving)
 {
     if (!isInit) {
         return Failed;
     }
 
-    bool isReset = false;
-    // return success by default in order to permit coincidence constraints to be applied
-    // even if no other system has to be solved
-    int res = Success;
+    std::vector<int> components;
     for (int cid = 0; cid < int(subSystems.size()); cid++) {
-        if ((subSystems[cid] || subSystemsAux[cid]) && !isReset) {
-            resetToReference();
-            isReset = true;
+        if (subSystems[cid] || subSystemsAux[cid]) {
+            components.push_back(cid);
         }
+    }
+    if (!components.empty()) {
+        resetToReference();
+    }
+
+    return solveComponents(components, isFine, alg, isRedundantsolving);
+}
+
+int System::solveIncremental(bool isFine, Algorithm alg)
+{
+    if (!isInit) {
+        return Failed;
+    }
+
+    // Only the temporary constraints change between the solves of a drag, so the components
+    // without any of them keep their last solution.
+    std::vector<int> components;
+    for (int cid = 0; cid < int(subSystems.size()); cid++) {
+        if (subSystemsAux[cid] || (subSystems[cid] && !solvedComponents[cid])) {
+            components.push_back(cid);
+        }
+    }
+
+    return solveComponents(components, isFine, alg, false);
+}
+
+int System::solveComponents(
+    const std::vector<int>& components,
+    bool isFine,
+    Algorithm alg,
+    bool isRedundantsolving
+)
+{
+    int paramsNum = 0;
+    for (int cid : components) {
+        paramsNum += subSystems[cid] ? subSystems[cid]->pSize() : 0;
+        paramsNum += subSystemsAux[cid] ? subSystemsAux[cid]->pSize() : 0;
+    }
+
+    std::vector<int> results(components.size(), Success);
+    auto solveComponent = [&](int i) {
+        int cid = components[i];
         if (subSystems[cid] && subSystemsAux[cid]) {
-            res = std::max(res, solve(subSystems[cid], subSystemsAux[cid], isFine, isRedundantsolving));
+            results[i] = solve(subSystems[cid], subSystemsAux[cid], isFine, isRedundantsolving);
         }
         else if (subSystems[cid]) {
-            res = std::max(res, solve(subSystems[cid], isFine, alg, isRedundantsolving));
+            results[i] = solve(subSystems[cid], isFine, alg, isRedundantsolving);
+        }
+        else {
+            results[i] = solve(subSystemsAux[cid], isFine, alg, isRedundantsolving);
         }
-        else if (subSystemsAux[cid]) {
-            res = std::max(res, solve(subSystemsAux[cid], isFine, alg, isRedundantsolving));
+    };
+
+    // The components share neither constraints nor parameters and every subsystem works on its
+    // own copy of its parameters, so the components can be solved concurrently. The iteration
+    // log is not thread-safe though.
+#ifdef _GCS_EXTRACT_SOLVER_SUBSYSTEM_
+    bool concurrent = false;
+#else
+    bool concurrent = components.size() > 1 && paramsNum >= minConcurrentParameters
+        && debugMode != IterationLevel;
+#endif
+    if (concurrent) {
+        concurrentFor(int(components.size()), solveComponent);
+    }
+    else {
+        for (int i = 0; i < int(components.size()); i++) {
+            solveComponent(i);
         }
     }
+
+    // return success by default in order to permit coincidence constraints to be applied
+    // even if no other system has to be solved
+    int res = Success;
+    for (int i = 0; i < int(components.size()); i++) {
+        solvedComponents[components[i]] = results[i] == Success;
+        res = std::max(res, results[i]);
+    }
     if (res == Success) {
         for (std::set<Constraint*>::const_iterator constr = redundant.begin();
              constr != redundant.end();
@@ -2087,8 +2187,106 @@ int System::solve_BFGS(SubSystem* subsys, bool /*isFine*/, bool isRedundantsolvi
     return Failed;
 }
 
+namespace
+{
+
+// solves (A + mu I) h = g and returns the relative error of the solution
+double solveAugmented(const Eigen::MatrixXd& A, double mu, const Eigen::VectorXd& g, Eigen::VectorXd& h)
+{
+    Eigen::MatrixXd augmented = A;
+    augmented.diagonal().array() += mu;
+    h = augmented.fullPivLu().solve(g);
+    return (augmented * h - g).norm() / g.norm();
+}
+
+void gaussNewtonStep(
+    DogLegGaussStep method,
+    SubSystem* /*subsys*/,
+    const Eigen::MatrixXd& Jx,
+    const Eigen::VectorXd& fx,
+    Eigen::VectorXd& h_gn
+)
+{
+    // https://forum.freecad.org/viewtopic.php?f=10&t=12769&start=50#p106220
+    // https://forum.kde.org/viewtopic.php?f=74&t=129439#p346104
+    switch (method) {
+        case FullPivLU:
+            h_gn = Jx.fullPivLu().solve(-fx);
+            break;
+        case LeastNormFullPivLU:
+            h_gn = Jx.adjoint() * (Jx * Jx.adjoint()).fullPivLu().solve(-fx);
+            break;
+        case LeastNormLdlt:
+            h_gn = Jx.adjoint() * (Jx * Jx.adjoint()).ldlt().solve(-fx);
+            break;
+    }
+}
+
+#ifdef EIGEN_SPARSEQR_COMPATIBLE
+double solveAugmented(
+    const Eigen::SparseMatrix<double>& A,
+    double mu,
+    const Eigen::VectorXd& g,
+    Eigen::VectorXd& h
+)
+{
+    // A = J^T J is positive semi-definite, so A + mu I is positive definite
+    Eigen::SparseMatrix<double> identity(A.rows(), A.cols());
+    identity.setIdentity();
+    Eigen::SparseMatrix<double> augmented = A + mu * identity;
+
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> ldlt(augmented);
+    if (ldlt.info() != Eigen::Success) {
+        return std::numeric_limits<double>::infinity();
+    }
+    h = ldlt.solve(g);
+    return (augmented * h - g).norm() / g.norm();
+}
+
+void gaussNewtonStep(
+    DogLegGaussStep method,
+    SubSystem* subsys,
+    const Eigen::SparseMatrix<double>& Jx,
+    const Eigen::VectorXd& fx,
+    Eigen::VectorXd& h_gn
+)
+{
+    // least norm step h = J^T (J J^T)^-1 (-fx). Overdetermined and inconsistent systems are
+    // left to the dense decompositions, which handle the rank deficiency more robustly.
+    if (Jx.rows() <= Jx.cols()) {
+        Eigen::SparseMatrix<double> JJt = Jx * Jx.transpose();
+        auto& ldlt = subsys->factorizeJJt(JJt);
+        if (ldlt.info() == Eigen::Success) {
+            Eigen::VectorXd y = ldlt.solve(-fx);
+            if (y.allFinite()) {
+                h_gn = Jx.transpose() * y;
+                if ((Jx * h_gn + fx).norm() <= 1e-6 * fx.norm()) {
+                    return;
+                }
+            }
+        }
+    }
+
+    gaussNewtonStep(method, subsys, Eigen::MatrixXd(Jx), fx, h_gn);
+}
+#endif
+
+}  // namespace
+
 int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
 {
+#ifdef EIGEN_SPARSEQR_COMPATIBLE
+    // each constraint only depends on a few parameters, so large Jacobians are mostly zeros
+    if (subsys->pSize() >= autoSparseThreshold) {
+        return solve_LM_impl<Eigen::SparseMatrix<double>>(subsys, isRedundantsolving);
+    }
+#endif
+    return solve_LM_impl<Eigen::MatrixXd>(subsys, isRedundantsolving);
+}
+
+template<typename JacobianMatrix>
+int System::solve_LM_impl(SubSystem* subsys, bool isRedundantsolving)
+{
 #ifdef _GCS_EXTRACT_SOLVER_SUBSYSTEM_
     extractSubsystem(subsys, isRedundantsolving);
 #endif
@@ -2102,8 +2300,8 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
 
     Eigen::VectorXd e(csize),
         e_new(csize);  // vector of all function errors (every constraint is one function)
-    Eigen::MatrixXd J(csize, xsize);  // Jacobi of the subsystem
-    Eigen::MatrixXd A(xsize, xsize);
+    JacobianMatrix J(csize, xsize);  // Jacobi of the subsystem
+    JacobianMatrix A(xsize, xsize);
     Eigen::VectorXd x(xsize), h(xsize), x_new(xsize), g(xsize), diag_A(xsize);
 
     subsys->redirectParams();
@@ -2161,7 +2359,7 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
 
         // Compute ||J^T e||_inf
         double g_inf = g.lpNorm<Eigen::Infinity>();
-        diag_A = A.diagonal();  // save diagonal entries so that augmentation can be later canceled
+        diag_A = A.diagonal();
 
         // check for convergence
         if (g_inf <= eps1) {
@@ -2178,14 +2376,8 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
         // determine increment using adaptive damping
         int k = 0;
         while (k < 50) {
-            // augment normal equations A = A+uI
-            for (int i = 0; i < xsize; ++i) {
-                A(i, i) += mu;
-            }
-
-            // solve augmented functions A*h=-g
-            h = A.fullPivLu().solve(g);
-            double rel_error = (A * h - g).norm() / g.norm();
+            // solve augmented functions (A+uI)*h=-g
+            double rel_error = solveAugmented(A, mu, g, h);
 
             // check if solving works
             if (rel_error < 1e-5) {
@@ -2235,9 +2427,6 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
 
             mu *= nu;
             nu *= 2.0;
-            for (int i = 0; i < xsize; ++i) {  // restore diagonal J^T J entries
-                A(i, i) = diag_A(i);
-            }
 
             k++;
         }
@@ -2268,6 +2457,17 @@ int System::solve_LM(SubSystem* subsys, bool isRedundantsolving)
 
 int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
 {
+#ifdef EIGEN_SPARSEQR_COMPATIBLE
+    if (subsys->pSize() >= autoSparseThreshold) {
+        return solve_DL_impl<Eigen::SparseMatrix<double>>(subsys, isRedundantsolving);
+    }
+#endif
+    return solve_DL_impl<Eigen::MatrixXd>(subsys, isRedundantsolving);
+}
+
+template<typename JacobianMatrix>
+int System::solve_DL_impl(SubSystem* subsys, bool isRedundantsolving)
+{
 #ifdef _GCS_EXTRACT_SOLVER_SUBSYSTEM_
     extractSubsystem(subsys, isRedundantsolving);
 #endif
@@ -2310,7 +2510,7 @@ int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
 
     Eigen::VectorXd x(xsize), x_new(xsize);
     Eigen::VectorXd fx(csize), fx_new(csize);
-    Eigen::MatrixXd Jx(csize, xsize), Jx_new(csize, xsize);
+    JacobianMatrix Jx(csize, xsize), Jx_new(csize, xsize);
     Eigen::VectorXd g(xsize), h_sd(xsize), h_gn(xsize), h_dl(xsize);
 
     subsys->redirectParams();
@@ -2362,19 +2562,7 @@ int System::solve_DL(SubSystem* subsys, bool isRedundantsolving)
         h_sd = alpha * g;
 
         // get the gauss-newton step
-        // https://forum.freecad.org/viewtopic.php?f=10&t=12769&start=50#p106220
-        // https://forum.kde.org/viewtopic.php?f=74&t=129439#p346104
-        switch (dogLegGaussStep) {
-            case FullPivLU:
-                h_gn = Jx.fullPivLu().solve(-fx);
-                break;
-            case LeastNormFullPivLU:
-                h_gn = Jx.adjoint() * (Jx * Jx.adjoint()).fullPivLu().solve(-fx);
-                break;
-            case LeastNormLdlt:
-                h_gn = Jx.adjoint() * (Jx * Jx.adjoint()).ldlt().solve(-fx);
-                break;
-        }
+        gaussNewtonStep(dogLegGaussStep, subsys, Jx, fx, h_gn);
 
         double rel_error = (Jx * h_gn + fx).norm() / fx.norm();
         if (rel_error > 1e15) {
@@ -4916,6 +5104,12 @@ int System::diagnose(Algorithm alg)
     // From here on, presuming `J.rows() > 0`.
     emptyDiagnoseMatrix = false;
 
+    // The constraints of disconnected parts of the sketch cannot depend on each other, so the
+    // decompositions are done for each part separately
+    if (diagnoseComponents(alg, J, jacobianconstraintmap, pdiagnoselist, tagmultiplicity)) {
+        return dofs;
+    }
+
     if (qrAlgorithm == EigenDenseQR) {
 #ifdef PROFILE_DIAGNOSE
         Base::TimeElapsed DenseQR_start_time;
@@ -5074,6 +5268,189 @@ int System::diagnose(Algorithm alg)
     return dofs;
 }
 
+bool System::diagnoseComponents(
+    Algorithm alg,
+    const Eigen::MatrixXd& J,
+    const std::map<int, int>& jacobianconstraintmap,
+    GCS::VEC_pD& pdiagnoselist,
+    const std::map<int, int>& tagmultiplicity
+)
+{
+    int constrNum = static_cast<int>(jacobianconstraintmap.size());
+    int paramsNum = static_cast<int>(pdiagnoselist.size());
+
+    // union-find of the parameters sharing a constraint
+    std::vector<int> parent(paramsNum);
+    std::iota(parent.begin(), parent.end(), 0);
+    auto findRoot = [&parent](int i) {
+        while (parent[i] != i) {
+            parent[i] = parent[parent[i]];
+            i = parent[i];
+        }
+        return i;
+    };
+
+    std::vector<int> rowParam(constrNum, -1);  // a parameter of each constraint
+    for (int col = 0; col < paramsNum; ++col) {
+        for (int row = 0; row < constrNum; ++row) {
+            if (J(row, col) == 0.) {
+                continue;
+            }
+            if (rowParam[row] < 0) {
+                rowParam[row] = col;
+            }
+            else {
+                parent[findRoot(col)] = findRoot(rowParam[row]);
+            }
+        }
+    }
+
+    struct Component
+    {
+        std::vector<int> rows, cols;
+    };
+    std::vector<Component> components;
+    std::vector<int> componentOfRoot(paramsNum, -1);
+    for (int col = 0; col < paramsNum; ++col) {
+        int root = findRoot(col);
+        if (componentOfRoot[root] < 0) {
+            componentOfRoot[root] = static_cast<int>(components.size());
+            components.emplace_back();
+        }
+        components[componentOfRoot[root]].cols.push_back(col);
+    }
+
+    if (components.size() < 2) {
+        return false;
+    }
+
+    for (int row = 0; row < constrNum; ++row) {
+        // constraints not depending on any diagnosed parameter go with the first component
+        int component = rowParam[row] < 0 ? 0 : componentOfRoot[findRoot(rowParam[row])];
+        components[component].rows.push_back(row);
+    }
+
+    struct ComponentDiagnosis
+    {
+        int rank = 0;  // rank of the transposed Jacobian
+        std::vector<std::vector<Constraint*>> conflictGroups;
+        std::vector<std::vector<double*>> parameterGroups;
+    };
+    std::vector<ComponentDiagnosis> results(components.size());
+
+    // Only the QR decompositions run concurrently. They are silent, as Base::Console is not
+    // thread-safe, and the redundant solving below is done once for the whole system.
+    auto diagnoseComponent = [&](int k) {
+        const Component& component = components[k];
+        ComponentDiagnosis& result = results[k];
+
+        Eigen::MatrixXd Jk(component.rows.size(), component.cols.size());
+        std::map<int, int> constraintmap;
+        GCS::VEC_pD params;
+        params.reserve(component.cols.size());
+        for (int j = 0; j < int(component.cols.size()); ++j) {
+            for (int i = 0; i < int(component.rows.size()); ++i) {
+                Jk(i, j) = J(component.rows[i], component.cols[j]);
+            }
+            params.push_back(pdiagnoselist[component.cols[j]]);
+        }
+        for (int i = 0; i < int(component.rows.size()); ++i) {
+            constraintmap[i] = jacobianconstraintmap.at(component.rows[i]);
+        }
+
+        if (component.rows.empty()) {
+            // nothing constrains these parameters
+            for (auto param : params) {
+                result.parameterGroups.push_back({param});
+            }
+            return;
+        }
+
+        int constrNumK = static_cast<int>(component.rows.size());
+        int paramsRank = 0;
+        Eigen::MatrixXd R, Rparams;
+
+        if (qrAlgorithm == EigenDenseQR) {
+            Eigen::FullPivHouseholderQR<Eigen::MatrixXd> qrJT, qrJ;
+            makeDenseQRDecomposition(Jk, constraintmap, qrJT, result.rank, R, true, true);
+            makeDenseQRDecomposition(Jk, constraintmap, qrJ, paramsRank, Rparams, false, true);
+
+            identifyDependentParameters(qrJ, Rparams, paramsRank, params, result.parameterGroups);
+            if (constrNumK > result.rank) {
+                identifyConflictGroups(
+                    qrJT,
+                    constraintmap,
+                    R,
+                    constrNumK,
+                    result.rank,
+                    result.conflictGroups
+                );
+            }
+        }
+#ifdef EIGEN_SPARSEQR_COMPATIBLE
+        else if (qrAlgorithm == EigenSparseQR) {
+            Eigen::SparseQR<Eigen::SparseMatrix<double>, Eigen::COLAMDOrdering<int>> SqrJT, SqrJ;
+            makeSparseQRDecomposition(Jk, constraintmap, SqrJT, result.rank, R, true, true);
+            makeSparseQRDecomposition(Jk, constraintmap, SqrJ, paramsRank, Rparams, false, true);
+
+            identifyDependentParameters(SqrJ, Rparams, paramsRank, params, result.parameterGroups);
+            if (constrNumK > result.rank) {
+                identifyConflictGroups(
+                    SqrJT,
+                    constraintmap,
+                    R,
+                    constrNumK,
+                    result.rank,
+                    result.conflictGroups
+                );
+            }
+        }
+#endif
+    };
+
+    if (paramsNum >= minConcurrentParameters) {
+        concurrentFor(int(components.size()), diagnoseComponent);
+    }
+    else {
+        for (int k = 0; k < int(components.size()); ++k) {
+            diagnoseComponent(k);
+        }
+    }
+
+    // the Jacobian is block diagonal, so its rank is the sum of the ranks of the components
+    int rank = 0;
+    std::vector<std::vector<Constraint*>> conflictGroups;
+    pDependentParametersGroups.clear();
+    for (auto& result : results) {
+        rank += result.rank;
+        std::ranges::move(result.conflictGroups, std::back_inserter(conflictGroups));
+        for (auto& group : result.parameterGroups) {
+            pDependentParameters.insert(pDependentParameters.end(), group.begin(), group.end());
+            pDependentParametersGroups.push_back(std::move(group));
+        }
+    }
+
+    dofs = paramsNum - rank;  // unless overconstraint, which will be overridden below
+
+    // Detecting conflicting or redundant constraints
+    if (constrNum > rank) {
+        int nonredundantconstrNum;
+        identifyConflictingRedundantConstraints(
+            alg,
+            conflictGroups,
+            tagmultiplicity,
+            pdiagnoselist,
+            constrNum,
+            nonredundantconstrNum
+        );
+        if (paramsNum == rank && nonredundantconstrNum > rank) {  // over-constrained
+            dofs = paramsNum - nonredundantconstrNum;
+        }
+    }
+
+    return true;
+}
+
 void System::makeDenseQRDecomposition(
     const Eigen::MatrixXd& J,
     const std::map<int, int>& jacobianconstraintmap,
@@ -5265,7 +5642,11 @@ void System::identifyDependentParametersDenseQR(
 
     makeDenseQRDecomposition(J, jacobianconstraintmap, qrJ, rank, Rparams, false, true);
 
-    identifyDependentParameters(qrJ, Rparams, rank, pdiagnoselist, silent);
+    identifyDependentParameters(qrJ, Rparams, rank, pdiagnoselist, pDependentParametersGroups, silent);
+
+    for (const auto& group : pDependentParametersGroups) {
+        pDependentParameters.insert(pDependentParameters.end(), group.begin(), group.end());
+    }
 }
 
 #ifdef EIGEN_SPARSEQR_COMPATIBLE
@@ -5291,7 +5672,18 @@ void System::identifyDependentParametersSparseQR(
         true
     );  // do not transpose allow one to diagnose parameters
 
-    identifyDependentParameters(SqrJ, Rparams, nontransprank, pdiagnoselist, silent);
+    identifyDependentParameters(
+        SqrJ,
+        Rparams,
+        nontransprank,
+        pdiagnoselist,
+        pDependentParametersGroups,
+        silent
+    );
+
+    for (const auto& group : pDependentParametersGroups) {
+        pDependentParameters.insert(pDependentParameters.end(), group.begin(), group.end());
+    }
 }
 #endif
 
@@ -5301,6 +5693,7 @@ void System::identifyDependentParameters(
     Eigen::MatrixXd& Rparams,
     int rank,
     const GCS::VEC_pD& pdiagnoselist,
+    std::vector<std::vector<double*>>& parameterGroups,
     bool silent
 )
 {
@@ -5318,20 +5711,19 @@ void System::identifyDependentParameters(
     }
 #endif
 
-    pDependentParametersGroups.resize(qrJ.cols() - rank);
+    parameterGroups.clear();
+    parameterGroups.resize(qrJ.cols() - rank);
     for (int j = rank; j < qrJ.cols(); j++) {
         for (int row = 0; row < rank; row++) {
             if (fabs(Rparams(row, j)) > 1e-10) {
                 int origCol = qrJ.colsPermutation().indices()[row];
 
-                pDependentParametersGroups[j - rank].push_back(pdiagnoselist[origCol]);
-                pDependentParameters.push_back(pdiagnoselist[origCol]);
+                parameterGroups[j - rank].push_back(pdiagnoselist[origCol]);
             }
         }
         int origCol = qrJ.colsPermutation().indices()[j];
 
-        pDependentParametersGroups[j - rank].push_back(pdiagnoselist[origCol]);
-        pDependentParameters.push_back(pdiagnoselist[origCol]);
+        parameterGroups[j - rank].push_back(pdiagnoselist[origCol]);
     }
 
 #ifdef _GCS_DEBUG
@@ -5343,7 +5735,7 @@ void System::identifyDependentParameters(
 
         SolverReportingManager::Manager().LogGroupOfParameters(
             "ParameterGroups",
-            pDependentParametersGroups
+            parameterGroups
         );
     }
 
@@ -5468,10 +5860,34 @@ void System::identifyConflictingRedundantConstraints(
     int rank,
     int& nonredundantconstrNum
 )
+{
+    std::vector<std::vector<Constraint*>> conflictGroups;
+    identifyConflictGroups(qrJT, jacobianconstraintmap, R, constrNum, rank, conflictGroups);
+
+    identifyConflictingRedundantConstraints(
+        alg,
+        conflictGroups,
+        tagmultiplicity,
+        pdiagnoselist,
+        constrNum,
+        nonredundantconstrNum
+    );
+}
+
+template<typename T>
+void System::identifyConflictGroups(
+    const T& qrJT,
+    const std::map<int, int>& jacobianconstraintmap,
+    Eigen::MatrixXd& R,
+    int constrNum,
+    int rank,
+    std::vector<std::vector<Constraint*>>& conflictGroups
+)
 {
     eliminateNonZerosOverPivotInUpperTriangularMatrix(R, rank);
 
-    std::vector<std::vector<Constraint*>> conflictGroups(constrNum - rank);
+    conflictGroups.clear();
+    conflictGroups.resize(constrNum - rank);
     for (int j = rank; j < constrNum; j++) {
         for (int row = 0; row < rank; row++) {
             if (fabs(R(row, j)) > 1e-10) {
@@ -5484,6 +5900,17 @@ void System::identifyConflictingRedundantConstraints(
 
         conflictGroups[j - rank].push_back(clist[jacobianconstraintmap.at(origCol)]);
     }
+}
+
+void System::identifyConflictingRedundantConstraints(
+    Algorithm alg,
+    std::vector<std::vector<Constraint*>>& conflictGroups,
+    const std::map<int, int>& tagmultiplicity,
+    GCS::VEC_pD& pdiagnoselist,
+    int constrNum,
+    int& nonredundantconstrNum
+)
+{
 
     // Augment the information regarding the group of constraints that are conflicting or redundant.
     if (debugMode == IterationLevel) {
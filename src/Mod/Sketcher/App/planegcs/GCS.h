@@ -124,6 +124,7 @@ private:
     std::map<double*, std::vector<Constraint*>> p2c;  // parameter to constraint adjacency list
 
     std::vector<SubSystem*> subSystems, subSystemsAux;
+    std::vector<bool> solvedComponents;  // if the last solve of a component succeeded
     void clearSubSystems();
 
     VEC_D reference;
@@ -145,9 +146,21 @@ private:
 
     bool emptyDiagnoseMatrix;  // false only if there is at least one driving constraint.
 
+    int solveComponents(
+        const std::vector<int>& components,
+        bool isFine,
+        Algorithm alg,
+        bool isRedundantsolving
+    );
+
     int solve_BFGS(SubSystem* subsys, bool isFine = true, bool isRedundantsolving = false);
     int solve_LM(SubSystem* subsys, bool isRedundantsolving = false);
     int solve_DL(SubSystem* subsys, bool isRedundantsolving = false);
+    // the iterations of solve_LM and solve_DL using a dense or a sparse Jacobian
+    template<typename JacobianMatrix>
+    int solve_LM_impl(SubSystem* subsys, bool isRedundantsolving);
+    template<typename JacobianMatrix>
+    int solve_DL_impl(SubSystem* subsys, bool isRedundantsolving);
 
     void makeReducedJacobian(
         Eigen::MatrixXd& J,
@@ -187,6 +200,26 @@ private:
         int rank
     );
 
+    // Diagnoses each connected component of the reduced Jacobian separately and concurrently.
+    // Returns false, leaving the diagnosis to the caller, if there is a single component.
+    bool diagnoseComponents(
+        Algorithm alg,
+        const Eigen::MatrixXd& J,
+        const std::map<int, int>& jacobianconstraintmap,
+        GCS::VEC_pD& pdiagnoselist,
+        const std::map<int, int>& tagmultiplicity
+    );
+
+    template<typename T>
+    void identifyConflictGroups(
+        const T& qrJT,
+        const std::map<int, int>& jacobianconstraintmap,
+        Eigen::MatrixXd& R,
+        int constrNum,
+        int rank,
+        std::vector<std::vector<Constraint*>>& conflictGroups
+    );
+
     template<typename T>
     void identifyConflictingRedundantConstraints(
         Algorithm alg,
@@ -200,6 +233,15 @@ private:
         int& nonredundantconstrNum
     );
 
+    void identifyConflictingRedundantConstraints(
+        Algorithm alg,
+        std::vector<std::vector<Constraint*>>& conflictGroups,
+        const std::map<int, int>& tagmultiplicity,
+        GCS::VEC_pD& pdiagnoselist,
+        int constrNum,
+        int& nonredundantconstrNum
+    );
+
     void eliminateNonZerosOverPivotInUpperTriangularMatrix(Eigen::MatrixXd& R, int rank);
 
 #ifdef EIGEN_SPARSEQR_COMPATIBLE
@@ -224,6 +266,7 @@ private:
         Eigen::MatrixXd& Rparams,
         int rank,
         const GCS::VEC_pD& pdiagnoselist,
+        std::vector<std::vector<double*>>& parameterGroups,
         bool silent = true
     );
 
@@ -241,6 +284,8 @@ public:
     QRAlgorithm qrAlgorithm;
     bool autoChooseAlgorithm;
     int autoQRThreshold;
+    int autoSparseThreshold;  // subsystems with at least this many parameters are solved by LM
+                              // and DL using a sparse Jacobian
     DogLegGaussStep dogLegGaussStep;
     double qrpivotThreshold;
     DebugMode debugMode;
@@ -610,6 +655,10 @@ public:
 
     int solve(bool isFine = true, Algorithm alg = DogLeg, bool isRedundantsolving = false);
     int solve(VEC_pD& params, bool isFine = true, Algorithm alg = DogLeg, bool isRedundantsolving = false);
+    // Solves again after the values of the parameters of the temporary constraints changed,
+    // starting from the last solution instead of the reference. Only the components with temporary
+    // constraints and those whose last solve failed are solved. Meant for dragging.
+    int solveIncremental(bool isFine = true, Algorithm alg = DogLeg);
     int solve(
         SubSystem* subsys,
         bool isFine = true,
@@ -38,6 +38,7 @@ namespace GCS
 // SubSystem
 SubSystem::SubSystem(std::vector<Constraint*>& clist_, VEC_pD& params)
     : clist(clist_)
+    , jjtNonZeros(-1)
 {
     MAP_pD_pD dummymap;
     initialize(params, dummymap);
@@ -45,6 +46,7 @@ SubSystem::SubSystem(std::vector<Constraint*>& clist_, VEC_pD& params)
 
 SubSystem::SubSystem(std::vector<Constraint*>& clist_, VEC_pD& params, MAP_pD_pD& reductionmap)
     : clist(clist_)
+    , jjtNonZeros(-1)
 {
     initialize(params, reductionmap);
 }
@@ -266,7 +268,36 @@ void SubSystem::calcJacobi(VEC_pD& params, Eigen::MatrixXd& jacobi)
 
 void SubSystem::calcJacobi(Eigen::MatrixXd& jacobi)
 {
-    calcJacobi(plist, jacobi);
+    // every constraint depends on a few parameters only, so just these derivatives are computed
+    jacobi.setZero(csize, psize);
+    for (int i = 0; i < csize; i++) {
+        auto it = c2p.find(clist[i]);
+        if (it == c2p.end()) {
+            continue;
+        }
+        for (double* param : it->second) {
+            // c2p refers to the entries of pvals, which hold the parameters in plist order
+            jacobi(i, int(param - pvals.data())) = clist[i]->grad(param);
+        }
+    }
+}
+
+void SubSystem::calcJacobi(Eigen::SparseMatrix<double>& jacobi)
+{
+    std::vector<Eigen::Triplet<double>> entries;
+    entries.reserve(csize * 4);
+    for (int i = 0; i < csize; i++) {
+        auto it = c2p.find(clist[i]);
+        if (it == c2p.end()) {
+            continue;
+        }
+        for (double* param : it->second) {
+            entries.emplace_back(i, int(param - pvals.data()), clist[i]->grad(param));
+        }
+    }
+
+    jacobi.resize(csize, psize);
+    jacobi.setFromTriplets(entries.begin(), entries.end());
 }
 
 void SubSystem::calcGrad(VEC_pD& params, Eigen::VectorXd& grad)
@@ -292,6 +323,20 @@ void SubSystem::calcGrad(Eigen::VectorXd& grad)
     calcGrad(plist, grad);
 }
 
+Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>>& SubSystem::factorizeJJt(
+    const Eigen::SparseMatrix<double>& JJt
+)
+{
+    // calcJacobi keeps an entry for every constraint parameter pair of c2p, even when its value is
+    // zero, so the pattern of J J^T only changes with the subsystem itself
+    if (JJt.nonZeros() != jjtNonZeros) {
+        jjtLdlt.analyzePattern(JJt);
+        jjtNonZeros = JJt.nonZeros();
+    }
+    jjtLdlt.factorize(JJt);
+    return jjtLdlt;
+}
+
 double SubSystem::maxStep(VEC_pD& params, Eigen::VectorXd& xdir)
 {
     assert(xdir.size() == int(params.size()));
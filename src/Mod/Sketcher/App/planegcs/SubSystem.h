@@ -28,6 +28,8 @@
 #undef max
 
 #include <Eigen/Core>
+#include <Eigen/SparseCholesky>
+#include <Eigen/SparseCore>
 
 #include "Constraints.h"
 
@@ -46,6 +48,10 @@ private:
                      //        JacobianMatrix jacobi;  // jacobi matrix of the residuals
     std::map<Constraint*, VEC_pD> c2p;                // constraint to parameter adjacency list
     std::map<double*, std::vector<Constraint*>> p2c;  // parameter to constraint adjacency list
+    // factorization of J J^T, whose symbolic analysis is kept as long as the sparsity pattern of
+    // the Jacobian does not change
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>> jjtLdlt;
+    Eigen::Index jjtNonZeros;
     void initialize(VEC_pD& params, MAP_pD_pD& reductionmap);  // called by the constructors
 public:
     SubSystem(std::vector<Constraint*>& clist_, VEC_pD& params);
@@ -79,9 +85,15 @@ public:
     void calcResidual(Eigen::VectorXd& r, double& err);
     void calcJacobi(VEC_pD& params, Eigen::MatrixXd& jacobi);
     void calcJacobi(Eigen::MatrixXd& jacobi);
+    void calcJacobi(Eigen::SparseMatrix<double>& jacobi);
     void calcGrad(VEC_pD& params, Eigen::VectorXd& grad);
     void calcGrad(Eigen::VectorXd& grad);
 
+    // factorizes JJt = J J^T, analysing its sparsity pattern only on the first call
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>>& factorizeJJt(
+        const Eigen::SparseMatrix<double>& JJt
+    );
+
     double maxStep(VEC_pD& params, Eigen::VectorXd& xdir);
     double maxStep(Eigen::VectorXd& xdir);
 
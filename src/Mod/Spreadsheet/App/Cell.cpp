@@ -30,6 +30,7 @@
 #include <sstream>
 
 
+#include <App/CompiledExpression.h>
 #include <App/ExpressionParser.h>
 #include <Base/Console.h>
 #include <Base/Quantity.h>
@@ -213,6 +214,7 @@ void Cell::setExpression(App::ExpressionPtr&& expr)
     }
 
     expression = std::move(expr);
+    compiledExpression.reset();
     setUsed(EXPRESSION_SET, !!expression);
 
     /* Update dependencies */
@@ -240,6 +242,23 @@ const App::Expression* Cell::getExpression(bool withFormat) const
     return expression.get();
 }
 
+/**
+ * Get the expression compiled for evaluation without Python.
+ *
+ * The compiled expression is created on first use and refers to the
+ * expression tree of this cell, so it must not outlive the cell.
+ */
+
+std::shared_ptr<App::CompiledExpression> Cell::getCompiledExpression() const
+{
+    if (!compiledExpression && expression) {
+        compiledExpression = App::CompiledExpression::compile(
+            std::shared_ptr<const App::Expression>(expression.get(), [](const App::Expression*) {})
+        );
+    }
+    return compiledExpression;
+}
+
 /**
  * Get string content.
  *
@@ -295,6 +314,7 @@ void Cell::setContent(const char* value)
                 return;
             }
             expression = std::make_unique<App::StringExpression>(sheet, value);
+            compiledExpression.reset();
             setUsed(EXPRESSION_SET, true);
             return;
         }
@@ -1009,6 +1029,7 @@ void Cell::visit(App::ExpressionVisitor& v)
 {
     if (expression) {
         expression->visit(v);
+        compiledExpression.reset();
     }
 }
 
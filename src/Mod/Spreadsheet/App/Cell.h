@@ -24,6 +24,7 @@
 
 #pragma once
 
+#include <memory>
 #include <set>
 #include <string>
 
@@ -36,6 +37,11 @@
 #include "Utils.h"
 
 
+namespace App
+{
+class CompiledExpression;
+}  // namespace App
+
 namespace Base
 {
 class Unit;
@@ -65,6 +71,8 @@ public:
 
     const App::Expression* getExpression(bool withFormat = false) const;
 
+    std::shared_ptr<App::CompiledExpression> getCompiledExpression() const;
+
     bool getStringContent(std::string& s, bool persistent = false) const;
 
     void setContent(const char* value);
@@ -208,6 +216,7 @@ private:
 
     unsigned int used;
     mutable App::ExpressionPtr expression;
+    mutable std::shared_ptr<App::CompiledExpression> compiledExpression;
     int alignment;
     std::set<std::string> style;
     Base::Color foregroundColor;
@@ -72,6 +72,8 @@ void PropertySheet::clear()
     cellToPropertyNameMap.clear();
     documentObjectToCellMap.clear();
     cellToDocumentObjectMap.clear();
+    cellToDependentCellMap.clear();
+    cellToReferencedCellMap.clear();
     aliasProp.clear();
     revAliasProp.clear();
 
@@ -287,6 +289,8 @@ PropertySheet::PropertySheet(const PropertySheet& other)
     , cellToPropertyNameMap(other.cellToPropertyNameMap)
     , documentObjectToCellMap(other.documentObjectToCellMap)
     , cellToDocumentObjectMap(other.cellToDocumentObjectMap)
+    , cellToDependentCellMap(other.cellToDependentCellMap)
+    , cellToReferencedCellMap(other.cellToReferencedCellMap)
     , aliasProp(other.aliasProp)
     , revAliasProp(other.revAliasProp)
     , updateCount(other.updateCount)
@@ -1473,6 +1477,10 @@ void PropertySheet::addDependencies(CellAddress key)
                 App::CellAddress addr = stringToAddress(propName.c_str(), true);
                 if (addr.isValid()) {
                     propName = addr.toString(App::CellAddress::Cell::ShowRowColumn);
+                    if (docObj == owner) {
+                        cellToDependentCellMap[addr].insert(key);
+                        cellToReferencedCellMap[key].insert(addr);
+                    }
                 }
                 std::string fullName = docObjName + "." + propName;
                 FC_LOG("dep " << key.toString() << " -> " << propName);
@@ -1487,6 +1495,10 @@ void PropertySheet::addDependencies(CellAddress key)
                     auto j = other->cells.revAliasProp.find(propName);
 
                     if (j != other->cells.revAliasProp.end()) {
+                        if (docObj == owner) {
+                            cellToDependentCellMap[j->second].insert(key);
+                            cellToReferencedCellMap[key].insert(j->second);
+                        }
                         fullName = docObjName + "." + j->second.toString();
                         FC_LOG("dep " << key.toString() << " -> " << fullName);
 
@@ -1530,6 +1542,24 @@ void PropertySheet::removeDependencies(CellAddress key)
         cellToPropertyNameMap.erase(i1);
     }
 
+    auto i3 = cellToReferencedCellMap.find(key);
+
+    if (i3 != cellToReferencedCellMap.end()) {
+        for (const auto& addr : i3->second) {
+            auto k = cellToDependentCellMap.find(addr);
+
+            if (k != cellToDependentCellMap.end()) {
+                k->second.erase(key);
+
+                if (k->second.empty()) {
+                    cellToDependentCellMap.erase(k);
+                }
+            }
+        }
+
+        cellToReferencedCellMap.erase(i3);
+    }
+
     /* Remove from DocumentObject <-> Key maps */
 
     std::map<CellAddress, std::set<std::string>>::iterator i2 = cellToDocumentObjectMap.find(key);
@@ -1759,6 +1789,23 @@ const std::set<std::string>& PropertySheet::getDeps(CellAddress pos) const
     }
 }
 
+/**
+ * Get the cells of this sheet that depend on the cell at \a pos.
+ */
+
+const std::set<CellAddress>& PropertySheet::getDependentCells(CellAddress pos) const
+{
+    static std::set<CellAddress> empty;
+    auto i = cellToDependentCellMap.find(pos);
+
+    if (i != cellToDependentCellMap.end()) {
+        return i->second;
+    }
+    else {
+        return empty;
+    }
+}
+
 void PropertySheet::recomputeDependencies(CellAddress key)
 {
     AtomicPropertyChange signaller(*this);
@@ -227,6 +227,8 @@ public:
 
     const std::set<std::string>& getDeps(App::CellAddress pos) const;
 
+    const std::set<App::CellAddress>& getDependentCells(App::CellAddress pos) const;
+
     void recomputeDependencies(App::CellAddress key);
 
     PyObject* getPyObject() override;
@@ -354,6 +356,16 @@ private:
     /*! DocumentObject this cell depends on */
     std::map<App::CellAddress, std::set<std::string>> cellToDocumentObjectMap;
 
+    /*! Cell dependencies within this sheet, i.e. when the cell given in key
+      changes, the set of addresses needs to be recomputed. Same as the
+      entries of propertyNameToCellMap referring to this sheet, but without
+      going through strings.
+      */
+    std::map<App::CellAddress, std::set<App::CellAddress>> cellToDependentCellMap;
+
+    /*! Cells of this sheet this cell depends on */
+    std::map<App::CellAddress, std::set<App::CellAddress>> cellToReferencedCellMap;
+
     /*! Mapping of cell position to alias property */
     std::map<App::CellAddress, std::string> aliasProp;
 
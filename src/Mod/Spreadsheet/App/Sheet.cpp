@@ -24,9 +24,14 @@
 
 #include <boost/tokenizer.hpp>
 #include <boost/regex.hpp>
+#include <algorithm>
+#include <atomic>
 #include <deque>
+#include <future>
 #include <memory>
+#include <optional>
 #include <sstream>
+#include <thread>
 #include <tuple>
 #include <list>
 #include <map>
@@ -40,6 +45,7 @@
 #include <boost/graph/topological_sort.hpp>
 
 #include <App/Application.h>
+#include <App/CompiledExpression.h>
 #include <App/Document.h>
 #include <App/DynamicProperty.h>
 #include <App/ExpressionParser.h>
@@ -774,15 +780,36 @@ struct CurrentAddressLock
     int& col;
 };
 
+/**
+ * Evaluate a cell expression without Python, see App::CompiledExpression.
+ *
+ * @returns The numeric result, or nothing if the expression must be
+ * evaluated with Expression::eval().
+ */
+
+static std::optional<Base::Quantity> evaluateCompiled(const CompiledExpression* compiled)
+{
+    CompiledExpression::Value value;
+    if (!compiled || !compiled->evaluate(value)) {
+        return std::nullopt;
+    }
+    // Booleans are stored as Python objects, leave them to the regular evaluation
+    if (value.kind == CompiledExpression::Value::Kind::Boolean) {
+        return std::nullopt;
+    }
+    return value.quantity;
+}
+
 /**
  * Update the Property given by \a key. This will also eventually trigger recomputations of cells
  * depending on \a key.
  *
  * @param key The address of the cell we want to recompute.
+ * @param value The numeric value of the cell if it has already been evaluated.
  *
  */
 
-void Sheet::updateProperty(CellAddress key)
+void Sheet::updateProperty(CellAddress key, const Base::Quantity* value)
 {
     Cell* cell = getCell(key);
 
@@ -791,8 +818,21 @@ void Sheet::updateProperty(CellAddress key)
         const Expression* input = cell->getExpression();
 
         if (input) {
-            CurrentAddressLock lock(currentRow, currentCol, key);
-            output = input->eval();
+            std::optional<Base::Quantity> number;
+            if (value) {
+                number = *value;
+            }
+            else {
+                number = evaluateCompiled(cell->getCompiledExpression().get());
+            }
+
+            if (number) {
+                output = std::make_unique<NumberExpression>(this, *number);
+            }
+            else {
+                CurrentAddressLock lock(currentRow, currentCol, key);
+                output = input->eval();
+            }
         }
         else {
             std::string s;
@@ -929,9 +969,10 @@ void Sheet::recomputeCells(Range range)
 /**
  * @brief Recompute cell at address \a p.
  * @param p Address of cell.
+ * @param value Numeric value of the cell if it has already been evaluated.
  */
 
-void Sheet::recomputeCell(CellAddress p)
+void Sheet::recomputeCell(CellAddress p, const Base::Quantity* value)
 {
     Cell* cell = cells.getValue(p);
 
@@ -940,9 +981,10 @@ void Sheet::recomputeCell(CellAddress p)
             std::string content;
             cell->getStringContent(content);
             cell->setContent(content.c_str());
+            value = nullptr;
         }
 
-        updateProperty(p);
+        updateProperty(p, value);
 
         if (!cell || !cell->hasException()) {
             cells.clearDirty(p);
@@ -1063,6 +1105,128 @@ void Sheet::updateBindings()
     }
 }
 
+/**
+ * Add the cells depending on \a dirtyCells to it, and group all of them into
+ * levels. The cells of a level only depend on cells of earlier levels, so
+ * recomputing the levels in order is a valid evaluation order, and the cells
+ * of one level can be evaluated independently of each other.
+ *
+ * @param dirtyCells The cells to recompute, extended by their dependents.
+ * @returns The levels, each sorted by address.
+ * @throws boost::not_a_dag if the cells contain a dependency cycle.
+ */
+
+std::vector<std::vector<CellAddress>> Sheet::getRecomputeLevels(std::set<CellAddress>& dirtyCells) const
+{
+    std::deque<CellAddress> workQueue(dirtyCells.begin(), dirtyCells.end());
+    while (!workQueue.empty()) {
+        CellAddress currPos = workQueue.front();
+        workQueue.pop_front();
+
+        for (const auto& dep : cells.getDependentCells(currPos)) {
+            if (dirtyCells.insert(dep).second) {
+                workQueue.push_back(dep);
+            }
+        }
+    }
+
+    // Count the dirty cells each cell waits for
+    std::map<CellAddress, int> pending;
+    for (const auto& addr : dirtyCells) {
+        pending.emplace(addr, 0);
+    }
+    for (const auto& addr : dirtyCells) {
+        for (const auto& dep : cells.getDependentCells(addr)) {
+            ++pending[dep];
+        }
+    }
+
+    std::vector<std::vector<CellAddress>> levels;
+    std::vector<CellAddress> level;
+    for (const auto& v : pending) {
+        if (v.second == 0) {
+            level.push_back(v.first);
+        }
+    }
+
+    std::size_t count = 0;
+    while (!level.empty()) {
+        count += level.size();
+        std::vector<CellAddress> next;
+        for (const auto& addr : level) {
+            for (const auto& dep : cells.getDependentCells(addr)) {
+                if (--pending[dep] == 0) {
+                    next.push_back(dep);
+                }
+            }
+        }
+        std::sort(next.begin(), next.end());
+        levels.push_back(std::move(level));
+        level = std::move(next);
+    }
+
+    if (count != dirtyCells.size()) {
+        throw boost::not_a_dag();
+    }
+    return levels;
+}
+
+/**
+ * Evaluate the cells of one recompute level that have a compiled expression.
+ * The cells don't depend on each other, so large levels are evaluated
+ * concurrently. This only reads properties, the results are assigned by the
+ * caller.
+ *
+ * @returns The numeric value of each cell, or nothing if the cell must be
+ * evaluated the regular way.
+ */
+
+static std::vector<std::optional<Base::Quantity>> evaluateCells(
+    PropertySheet& cells,
+    const std::vector<CellAddress>& level
+)
+{
+    // Not worth the thread overhead below this
+    constexpr std::size_t minConcurrentCells = 256;
+
+    std::vector<std::optional<Base::Quantity>> values(level.size());
+    std::vector<std::shared_ptr<CompiledExpression>> programs(level.size());
+    std::size_t compiledCount = 0;
+    for (std::size_t i = 0; i < level.size(); ++i) {
+        Cell* cell = cells.getValue(level[i]);
+        if (cell && !cell->hasException() && cell->getExpression()) {
+            programs[i] = cell->getCompiledExpression();
+            if (programs[i] && programs[i]->isValid()) {
+                ++compiledCount;
+            }
+        }
+    }
+    if (compiledCount < minConcurrentCells) {
+        // Evaluated on demand by updateProperty()
+        return values;
+    }
+
+    std::atomic<std::size_t> next {0};
+    auto worker = [&]() {
+        for (std::size_t i = next++; i < level.size(); i = next++) {
+            values[i] = evaluateCompiled(programs[i].get());
+        }
+    };
+
+    std::size_t threads =
+        std::min<std::size_t>(std::max(1U, std::thread::hardware_concurrency()), compiledCount);
+    std::vector<std::future<void>> futures;
+    futures.reserve(threads - 1);
+    for (std::size_t i = 1; i < threads; ++i) {
+        futures.push_back(std::async(std::launch::async, worker));
+    }
+    worker();
+    for (auto& future : futures) {
+        future.get();
+    }
+    return values;
+}
+
 /**
  * Update the document properties.
  *
@@ -1081,56 +1245,28 @@ DocumentObjectExecReturn* Sheet::execute()
         dirtyCells.insert(cellError);
     }
 
-    DependencyList graph;
-    std::map<CellAddress, Vertex> VertexList;
-    std::map<Vertex, CellAddress> VertexIndexList;
-    std::deque<CellAddress> workQueue(dirtyCells.begin(), dirtyCells.end());
-    while (!workQueue.empty()) {
-        CellAddress currPos = workQueue.front();
-        workQueue.pop_front();
-
-        // Insert into map of CellPos -> Index, if it doesn't exist already
-        auto res = VertexList.emplace(currPos, Vertex());
-        if (res.second) {
-            res.first->second = add_vertex(graph);
-            VertexIndexList[res.first->second] = currPos;
-        }
-
-        // Process cells that depend on the current cell
-        for (auto& dep : providesTo(currPos)) {
-            auto resDep = VertexList.emplace(dep, Vertex());
-            if (resDep.second) {
-                resDep.first->second = add_vertex(graph);
-                VertexIndexList[resDep.first->second] = dep;
-                if (dirtyCells.insert(dep).second) {
-                    workQueue.push_back(dep);
-                }
-            }
-            // Add edge to graph to signal dependency
-            add_edge(res.first->second, resDep.first->second, graph);
-        }
-    }
     // Compute cells
-    std::list<Vertex> make_order;
-    // Sort graph topologically to find evaluation order
     try {
-        boost::topological_sort(graph, std::front_inserter(make_order));
+        // Sort cells topologically to find evaluation order
+        auto levels = getRecomputeLevels(dirtyCells);
         // Recompute cells
         FC_LOG("recomputing " << getFullName());
-        for (auto& pos : make_order) {
-            const auto& addr = VertexIndexList[pos];
-            FC_TRACE(addr.toString());
-            recomputeCell(addr);
+        for (const auto& level : levels) {
+            auto values = evaluateCells(cells, level);
+            for (std::size_t i = 0; i < level.size(); ++i) {
+                FC_TRACE(level[i].toString());
+                recomputeCell(level[i], values[i] ? &*values[i] : nullptr);
+            }
         }
     }
     catch (std::exception&) {
-        for (auto& v : VertexList) {
-            Cell* cell = cells.getValue(v.first);
+        for (const auto& addr : dirtyCells) {
+            Cell* cell = cells.getValue(addr);
             // Mark as erroneous
             if (cell) {
-                cellErrors.insert(v.first);
+                cellErrors.insert(addr);
                 cell->setException("Pending computation due to cyclic dependency", true);
-                cellUpdated(v.first);
+                cellUpdated(addr);
             }
         }
 
@@ -1755,7 +1891,7 @@ void Sheet::providesTo(CellAddress address, std::set<std::string>& result) const
 
 std::set<CellAddress> Sheet::providesTo(CellAddress address) const
 {
-    return cells.getDeps(getFullName() + "." + address.toString());
+    return cells.getDependentCells(address);
 }
 
 void Sheet::onDocumentRestored()
@@ -268,13 +268,17 @@ protected:
 
     void onDocumentRestored() override;
 
-    void recomputeCell(App::CellAddress p);
+    void recomputeCell(App::CellAddress p, const Base::Quantity* value = nullptr);
+
+    std::vector<std::vector<App::CellAddress>> getRecomputeLevels(
+        std::set<App::CellAddress>& dirtyCells
+    ) const;
 
     App::Property* getProperty(App::CellAddress key) const;
 
     App::Property* getProperty(const char* addr) const;
 
-    void updateProperty(App::CellAddress key);
+    void updateProperty(App::CellAddress key, const Base::Quantity* value = nullptr);
 
     App::Property* setStringProperty(App::CellAddress key, const std::string& value);
 
@@ -87,6 +87,7 @@
 #include "EdgeWalker.h"
 #include "Geometry.h"
 #include "GeometryObject.h"
+#include "HLRCache.h"
 #include "ShapeExtractor.h"
 #include "Preferences.h"
 #include "ShapeUtils.h"
@@ -148,6 +149,15 @@ DrawViewPart::DrawViewPart()
     ADD_PROPERTY_TYPE(ScrubCount, (Preferences::scrubCount()), sgroup, App::Prop_None,
                       "The number of times FreeCAD should try to clean the HLR result.");
 
+    //HLR result saved with the document if the PersistHLR preference is set
+    ADD_PROPERTY_TYPE(HLRKey, (""), sgroup,
+                      (App::PropertyType)(App::Prop_Output | App::Prop_Hidden),
+                      "Key of the saved HLR result");
+    ADD_PROPERTY_TYPE(HLRResult, (TopoDS_Shape()), sgroup,
+                      (App::PropertyType)(App::Prop_Output | App::Prop_Hidden),
+                      "Saved HLR result");
+    setHLRTransient(!Preferences::persistHLR());
+
     //initialize bbox to non-garbage
     bbox = Base::BoundBox3d(Base::Vector3d(0.0, 0.0, 0.0), 0.0);
 }
@@ -352,6 +362,7 @@ TechDraw::GeometryObjectPtr DrawViewPart::buildGeometryObject(const TopoDS_Shape
     go->isPerspective(Perspective.getValue());
     go->setFocus(Focus.getValue());
     go->usePolygonHLR(CoarseView.getValue());
+    go->useParallelHLR(Preferences::parallelHLR());
     go->setScrubCount(ScrubCount.getValue());
 
     if (CoarseView.getValue()) {
@@ -386,6 +397,33 @@ TechDraw::GeometryObjectPtr DrawViewPart::buildGeometryObject(const TopoDS_Shape
     return go;
 }
 
+//! keep the HLR result in the document, so the views of a reopened document skip HLR
+void DrawViewPart::saveHLRResult()
+{
+    bool persist = Preferences::persistHLR();
+    setHLRTransient(!persist);
+    if (!persist) {
+        if (!HLRKey.isEmpty()) {
+            HLRKey.setValue("");
+            HLRResult.setValue(TopoDS_Shape());
+        }
+        return;
+    }
+
+    const std::string& key = geometryObject->getHLRKey();
+    if (key != HLRKey.getStrValue()) {
+        HLRKey.setValue(key);
+        HLRResult.setValue(key.empty() ? TopoDS_Shape() : geometryObject->packHLR());
+    }
+}
+
+//! without the PersistHLR preference the HLR properties are not written to the file
+void DrawViewPart::setHLRTransient(bool transient)
+{
+    HLRKey.setStatus(App::Property::Transient, transient);
+    HLRResult.setStatus(App::Property::Transient, transient);
+}
+
 //! continue processing after hlr thread completes
 void DrawViewPart::onHlrFinished()
 {
@@ -405,6 +443,7 @@ void DrawViewPart::onHlrFinished()
 
     //the last hlr related task is to make a bbox of the results
     bbox = geometryObject->calcBoundingBox();
+    saveHLRResult();
 
     waitingForHlr(false);
     QObject::disconnect(connectHlrWatcher);
@@ -1233,6 +1272,17 @@ bool DrawViewPart::newFaceFinder()
     return Preferences::getPreferenceGroup("General")->GetBool("NewFaceFinder", false);
 }
 
+void DrawViewPart::onDocumentRestored()
+{
+    //the first recompute of the view can use the HLR result saved with the document
+    if (!HLRKey.isEmpty() && !HLRResult.getValue().IsNull()) {
+        HLRCache::instance().insert(HLRKey.getStrValue(), HLRResult.getValue());
+    }
+    //the status restored from the file follows the preference of the saving session
+    setHLRTransient(!Preferences::persistHLR());
+    DrawView::onDocumentRestored();
+}
+
 //! remove features that are useless without this DVP
 //! hatches, geomhatches, dimensions, ...
 void DrawViewPart::unsetupObject()
@@ -34,6 +34,7 @@
 #include <App/FeaturePython.h>
 #include <App/PropertyLinks.h>
 #include <Base/BoundBox.h>
+#include <Mod/Part/App/PropertyTopoShape.h>
 #include <Mod/TechDraw/TechDrawGlobal.h>
 
 #include "CosmeticExtension.h"
@@ -134,6 +135,9 @@ public:
 
     App::PropertyInteger ScrubCount;
 
+    App::PropertyString HLRKey;
+    Part::PropertyPartShape HLRResult;
+
     short mustExecute() const override;
     App::DocumentObjectExecReturn* execute() override;
     const char* getViewProviderName() const override { return "TechDrawGui::ViewProviderViewPart"; }
@@ -257,7 +261,10 @@ protected:
     Base::BoundBox3d bbox;
 
     void onChanged(const App::Property* prop) override;
+    void onDocumentRestored() override;
     void unsetupObject() override;
+    void saveHLRResult();
+    void setHLRTransient(bool transient);
 
     virtual TechDraw::GeometryObjectPtr buildGeometryObject(const TopoDS_Shape& shape,
                                                             const gp_Ax2& viewAxis);
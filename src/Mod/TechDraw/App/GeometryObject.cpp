@@ -37,6 +37,7 @@
 #include <BRep_Builder.hxx>
 #include <BRep_Tool.hxx>
 #include <Bnd_Box.hxx>
+#include <Bnd_Box2d.hxx>
 #include <HLRAlgo_Projector.hxx>
 #include <HLRBRep.hxx>
 #include <HLRBRep_Algo.hxx>
@@ -46,6 +47,8 @@
 #include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopoDS.hxx>
+#include <TopoDS_Compound.hxx>
+#include <TopoDS_Iterator.hxx>
 #include <TopoDS_Edge.hxx>
 #include <TopoDS_Face.hxx>
 #include <TopoDS_Shape.hxx>
@@ -55,11 +58,18 @@
 #include <gp_Ax3.hxx>
 #include <gp_Dir.hxx>
 #include <gp_Pln.hxx>
+#include <gp_Pnt2d.hxx>
 #include <gp_Trsf.hxx>
 #include <gp_Vec.hxx>
 
 #include <algorithm>
 #include <chrono>
+#include <functional>
+#include <map>
+#include <numeric>
+
+#include <QThread>
+#include <QtConcurrentMap>
 
 #include <Base/Console.h>
 #include <Mod/Part/App/PartFeature.h>
@@ -70,6 +80,7 @@
 #include "DrawViewPart.h"
 #include "GeometryObject.h"
 #include "DrawProjectSplit.h"
+#include "HLRCache.h"
 #include "ShapeUtils.h"
 
 using namespace TechDraw;
@@ -79,7 +90,7 @@ using DU = DrawUtil;
 
 GeometryObject::GeometryObject(const string& parent, TechDraw::DrawView* parentObj)
     : m_parentName(parent), m_parent(parentObj), m_isoCount(0), m_isPersp(false), m_focus(100.0),
-      m_usePolygonHLR(false), m_scrubCount(0)
+      m_usePolygonHLR(false), m_parallelHLR(false), m_scrubCount(0)
 
 {}
 
@@ -140,6 +151,77 @@ void GeometryObject::projectShape(const TopoDS_Shape& inShape, const gp_Ax2& vie
 {
     clear();
 
+    //an unchanged shape seen from the same direction has the same hidden lines
+    m_hlrKey = HLRCache::makeKey(inShape, viewAxis, m_isoCount, m_isPersp, m_focus);
+    TopoDS_Shape cached;
+    if (!m_hlrKey.empty() && HLRCache::instance().find(m_hlrKey, cached) && unpackHLR(cached)) {
+        makeTDGeometry();
+        return;
+    }
+
+    std::vector<TopoDS_Shape> groups;
+    if (m_parallelHLR) {
+        groups = groupForHLR(inShape, viewAxis);
+    }
+
+    if (groups.size() > 1) {
+        projectGroups(groups, viewAxis);
+    }
+    else {
+        removeHiddenLines(inShape, viewAxis);
+    }
+
+    HLRCache::instance().insert(m_hlrKey, packHLR());
+
+    makeTDGeometry();
+}
+
+//! returns the HLR output as a compound of one compound per edge class.
+TopoDS_Shape GeometryObject::packHLR() const
+{
+    BRep_Builder builder;
+    TopoDS_Compound result;
+    builder.MakeCompound(result);
+    for (const TopoDS_Shape* edges : {&visHard, &visOutline, &visSmooth, &visSeam, &visIso,
+                                      &hidHard, &hidOutline, &hidSmooth, &hidSeam, &hidIso}) {
+        TopoDS_Compound compound;
+        builder.MakeCompound(compound);
+        if (!edges->IsNull()) {
+            builder.Add(compound, *edges);
+        }
+        builder.Add(result, compound);
+    }
+    return result;
+}
+
+//! restores the HLR output from a shape made by packHLR.
+bool GeometryObject::unpackHLR(const TopoDS_Shape& packed)
+{
+    std::vector<TopoDS_Shape> classes;
+    for (TopoDS_Iterator it(packed); it.More(); it.Next()) {
+        TopoDS_Iterator edges(it.Value());
+        classes.push_back(edges.More() ? edges.Value() : TopoDS_Shape());
+    }
+    if (classes.size() != 10) {
+        return false;
+    }
+
+    visHard = classes[0];
+    visOutline = classes[1];
+    visSmooth = classes[2];
+    visSeam = classes[3];
+    visIso = classes[4];
+    hidHard = classes[5];
+    hidOutline = classes[6];
+    hidSmooth = classes[7];
+    hidSeam = classes[8];
+    hidIso = classes[9];
+    return true;
+}
+
+//! run the exact HLR algorithm on inShape and keep its visible and hidden edges
+void GeometryObject::removeHiddenLines(const TopoDS_Shape& inShape, const gp_Ax2& viewAxis)
+{
     Handle(HLRBRep_Algo) brep_hlr;
     try {
         brep_hlr = new HLRBRep_Algo();
@@ -239,8 +321,212 @@ void GeometryObject::projectShape(const TopoDS_Shape& inShape, const gp_Ax2& vie
         throw Base::RuntimeError(
             "GeometryObject::projectShape - unknown error occurred while extracting edges");
     }
+}
 
-    makeTDGeometry();
+//! split the input into groups of components whose projected bounding boxes overlap.
+//! Components of different groups cannot hide each other, so the groups can be
+//! processed by separate HLR algorithms.  The groups are combined into a few bins of
+//! similar size to keep the overhead of the algorithm low.
+std::vector<TopoDS_Shape> GeometryObject::groupForHLR(const TopoDS_Shape& inShape,
+                                                      const gp_Ax2& viewAxis) const
+{
+    if (inShape.IsNull() || m_isPersp) {
+        // the bounding box of a shape near the eye does not project to its outline
+        return {};
+    }
+
+    std::vector<TopoDS_Shape> components;
+    std::function<void(const TopoDS_Shape&)> collect = [&](const TopoDS_Shape& shape) {
+        if (shape.ShapeType() != TopAbs_COMPOUND) {
+            components.push_back(shape);
+            return;
+        }
+        for (TopoDS_Iterator it(shape); it.More(); it.Next()) {
+            collect(it.Value());
+        }
+    };
+    collect(inShape);
+
+    size_t count = components.size();
+    if (count < 2) {
+        return {};
+    }
+
+    HLRAlgo_Projector projector(viewAxis);
+    std::vector<Bnd_Box2d> boxes(count);
+    for (size_t i = 0; i < count; i++) {
+        Bnd_Box box;
+        BRepBndLib::Add(components[i], box);
+        if (box.IsVoid()) {
+            continue;
+        }
+        double xMin, yMin, zMin, xMax, yMax, zMax;
+        box.Get(xMin, yMin, zMin, xMax, yMax, zMax);
+        for (int corner = 0; corner < 8; corner++) {
+            gp_Pnt point((corner & 1) ? xMax : xMin,
+                         (corner & 2) ? yMax : yMin,
+                         (corner & 4) ? zMax : zMin);
+            double x, y;
+            projector.Project(point, x, y);
+            boxes[i].Add(gp_Pnt2d(x, y));
+        }
+        boxes[i].Enlarge(Precision::Confusion());
+    }
+
+    // union the components with overlapping boxes, sweeping along the projected x axis
+    std::vector<size_t> parent(count);
+    std::iota(parent.begin(), parent.end(), 0);
+    auto findRoot = [&](size_t i) {
+        while (parent[i] != i) {
+            parent[i] = parent[parent[i]];
+            i = parent[i];
+        }
+        return i;
+    };
+
+    std::vector<size_t> order;
+    for (size_t i = 0; i < count; i++) {
+        if (!boxes[i].IsVoid()) {
+            order.push_back(i);
+        }
+    }
+    auto boxStart = [&](size_t i) {
+        double x0, y0, x1, y1;
+        boxes[i].Get(x0, y0, x1, y1);
+        return x0;
+    };
+    auto boxEnd = [&](size_t i) {
+        double x0, y0, x1, y1;
+        boxes[i].Get(x0, y0, x1, y1);
+        return x1;
+    };
+    std::sort(order.begin(), order.end(),
+              [&](size_t a, size_t b) { return boxStart(a) < boxStart(b); });
+
+    std::vector<size_t> active;
+    for (size_t i : order) {
+        double start = boxStart(i);
+        active.erase(std::remove_if(active.begin(), active.end(),
+                                    [&](size_t j) { return boxEnd(j) < start; }),
+                     active.end());
+        for (size_t j : active) {
+            if (!boxes[i].IsOut(boxes[j])) {
+                parent[findRoot(i)] = findRoot(j);
+            }
+        }
+        active.push_back(i);
+    }
+
+    // collect the groups, weighted by their number of faces
+    std::map<size_t, std::pair<TopoDS_Compound, int>> groups;
+    BRep_Builder builder;
+    for (size_t i = 0; i < count; i++) {
+        auto& [compound, faces] = groups[findRoot(i)];
+        if (compound.IsNull()) {
+            builder.MakeCompound(compound);
+        }
+        builder.Add(compound, components[i]);
+        for (TopExp_Explorer expl(components[i], TopAbs_FACE); expl.More(); expl.Next()) {
+            faces++;
+        }
+    }
+    if (groups.size() < 2) {
+        return {};
+    }
+
+    std::vector<std::pair<TopoDS_Compound, int>> sorted;
+    for (auto& entry : groups) {
+        sorted.push_back(entry.second);
+    }
+    std::sort(sorted.begin(), sorted.end(),
+              [](const auto& a, const auto& b) { return a.second > b.second; });
+
+    // the largest groups first, each into the bin with the fewest faces so far
+    size_t threads = std::max(1, QThread::idealThreadCount());
+    size_t binCount = std::min(sorted.size(), threads * 2);
+    std::vector<TopoDS_Shape> bins(binCount);
+    std::vector<int> binFaces(binCount, 0);
+    for (auto& [compound, faces] : sorted) {
+        size_t bin = std::min_element(binFaces.begin(), binFaces.end()) - binFaces.begin();
+        if (bins[bin].IsNull()) {
+            TopoDS_Compound binCompound;
+            builder.MakeCompound(binCompound);
+            bins[bin] = binCompound;
+        }
+        builder.Add(bins[bin], compound);
+        binFaces[bin] += std::max(faces, 1);
+    }
+
+    return bins;
+}
+
+//! run the HLR algorithm on each group in parallel and merge the resulting edges
+void GeometryObject::projectGroups(const std::vector<TopoDS_Shape>& groups, const gp_Ax2& viewAxis)
+{
+    struct Partial
+    {
+        TopoDS_Shape shape;
+        std::unique_ptr<GeometryObject> geometry;
+        std::string error;
+    };
+
+    std::vector<Partial> partials;
+    for (auto& group : groups) {
+        auto geometry = std::make_unique<GeometryObject>(m_parentName, m_parent);
+        geometry->setIsoCount(m_isoCount);
+        geometry->isPerspective(m_isPersp);
+        geometry->setFocus(m_focus);
+        partials.push_back({group, std::move(geometry), {}});
+    }
+
+    QtConcurrent::blockingMap(partials, [&viewAxis](Partial& partial) {
+        try {
+            // groups may share sub-shapes, so each algorithm works on its own topology
+            BRepBuilderAPI_Copy copier(partial.shape, false);
+            partial.geometry->removeHiddenLines(copier.Shape(), viewAxis);
+        }
+        catch (const Base::Exception& e) {
+            partial.error = e.what();
+        }
+        catch (const Standard_Failure& e) {
+            partial.error = e.GetMessageString();
+        }
+        catch (...) {
+            partial.error = "unknown error";
+        }
+    });
+
+    BRep_Builder builder;
+    auto merge = [&](TopoDS_Shape& target, const TopoDS_Shape& edges) {
+        if (edges.IsNull()) {
+            return;
+        }
+        if (target.IsNull()) {
+            TopoDS_Compound compound;
+            builder.MakeCompound(compound);
+            target = compound;
+        }
+        for (TopoDS_Iterator it(edges); it.More(); it.Next()) {
+            builder.Add(target, it.Value());
+        }
+    };
+
+    for (auto& partial : partials) {
+        if (!partial.error.empty()) {
+            throw Base::RuntimeError(partial.error);
+        }
+        GeometryObject& geometry = *partial.geometry;
+        merge(visHard, geometry.visHard);
+        merge(visOutline, geometry.visOutline);
+        merge(visSmooth, geometry.visSmooth);
+        merge(visSeam, geometry.visSeam);
+        merge(visIso, geometry.visIso);
+        merge(hidHard, geometry.hidHard);
+        merge(hidOutline, geometry.hidOutline);
+        merge(hidSmooth, geometry.hidSmooth);
+        merge(hidSeam, geometry.hidSeam);
+        merge(hidIso, geometry.hidIso);
+    }
 }
 
 //convert the hlr output into TD Geometry
@@ -81,6 +81,10 @@ public:
 
     void projectShape(const TopoDS_Shape& input, const gp_Ax2& viewAxis);
     void projectShapeWithPolygonAlgo(const TopoDS_Shape& input, const gp_Ax2& viewAxis);
+    TopoDS_Shape packHLR() const;
+    bool unpackHLR(const TopoDS_Shape& packed);
+    //! the key of the HLR result in the HLRCache, empty if it can't be cached
+    const std::string& getHLRKey() const { return m_hlrKey; }
     static TopoDS_Shape projectSimpleShape(const TopoDS_Shape& shape, const gp_Ax2& CS, bool invertYRequired = true);
     static TopoDS_Shape simpleProjection(const TopoDS_Shape& shape, const gp_Ax2& projCS);
     static TopoDS_Shape projectFace(const TopoDS_Shape& face, const gp_Ax2& CS);
@@ -94,6 +98,8 @@ public:
     bool isPerspective() { return m_isPersp; }
     void usePolygonHLR(bool b) { m_usePolygonHLR = b; }
     bool usePolygonHLR() const { return m_usePolygonHLR; }
+    void useParallelHLR(bool b) { m_parallelHLR = b; }
+    bool useParallelHLR() const { return m_parallelHLR; }
     void setFocus(double f) { m_focus = f; }
     double getFocus() { return m_focus; }
     void setScrubCount(int count) { m_scrubCount = count; }
@@ -140,6 +146,10 @@ protected:
     TopoDS_Shape hidSeam;
     TopoDS_Shape hidIso;
 
+    void removeHiddenLines(const TopoDS_Shape& input, const gp_Ax2& viewAxis);
+    std::vector<TopoDS_Shape> groupForHLR(const TopoDS_Shape& input, const gp_Ax2& viewAxis) const;
+    void projectGroups(const std::vector<TopoDS_Shape>& groups, const gp_Ax2& viewAxis);
+
     void addGeomFromCompound(TopoDS_Shape edgeCompound, EdgeClass category, bool visible);
     TechDraw::DrawViewDetail* isParentDetail();
 
@@ -163,6 +173,8 @@ protected:
     bool m_isPersp;
     double m_focus;
     bool m_usePolygonHLR;
+    bool m_parallelHLR;
+    std::string m_hlrKey;
     int m_scrubCount;
 };
 
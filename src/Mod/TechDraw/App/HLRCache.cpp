@@ -0,0 +1,104 @@
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+/***************************************************************************
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+//! a cache of the results of the hidden line removal of DrawViewPart
+
+#include <algorithm>
+#include <vector>
+
+#include <Mod/Part/App/Tools.h>
+
+#include "HLRCache.h"
+#include "Preferences.h"
+
+using namespace TechDraw;
+
+HLRCache::HLRCache(size_t maxEntries)
+    : m_maxEntries(maxEntries)
+{
+}
+
+HLRCache& HLRCache::instance()
+{
+    static HLRCache cache(std::max(0, Preferences::hlrCacheSize()));
+    return cache;
+}
+
+std::string HLRCache::makeKey(const TopoDS_Shape& shape, const gp_Ax2& viewAxis, int isoCount,
+                              bool isPerspective, double focus)
+{
+    const gp_Pnt& origin = viewAxis.Location();
+    const gp_Dir& direction = viewAxis.Direction();
+    const gp_Dir& xDirection = viewAxis.XDirection();
+    std::vector<double> parameters;
+    for (int i = 1; i <= 3; i++) {
+        parameters.push_back(origin.Coord(i));
+        parameters.push_back(direction.Coord(i));
+        parameters.push_back(xDirection.Coord(i));
+    }
+    parameters.push_back(isoCount);
+    parameters.push_back(isPerspective ? focus : 0.0);
+    return Part::Tools::getShapeKey(shape, parameters);
+}
+
+bool HLRCache::find(const std::string& key, TopoDS_Shape& result)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_index.find(key);
+    if (it == m_index.end()) {
+        return false;
+    }
+
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+    result = it->second->second;
+    return true;
+}
+
+void HLRCache::insert(const std::string& key, const TopoDS_Shape& result)
+{
+    if (key.empty() || m_maxEntries == 0) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_index.find(key);
+    if (it != m_index.end()) {
+        it->second->second = result;
+        m_entries.splice(m_entries.begin(), m_entries, it->second);
+        return;
+    }
+
+    m_entries.emplace_front(key, result);
+    m_index[key] = m_entries.begin();
+    while (m_entries.size() > m_maxEntries) {
+        m_index.erase(m_entries.back().first);
+        m_entries.pop_back();
+    }
+}
+
+void HLRCache::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.clear();
+    m_index.clear();
+}
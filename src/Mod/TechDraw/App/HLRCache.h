@@ -0,0 +1,70 @@
+// SPDX-License-Identifier: LGPL-2.0-or-later
+
+/***************************************************************************
+ *                                                                         *
+ *   This file is part of the FreeCAD CAx development system.              *
+ *                                                                         *
+ *   This library is free software; you can redistribute it and/or         *
+ *   modify it under the terms of the GNU Library General Public           *
+ *   License as published by the Free Software Foundation; either          *
+ *   version 2 of the License, or (at your option) any later version.      *
+ *                                                                         *
+ *   This library  is distributed in the hope that it will be useful,      *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU Library General Public License for more details.                  *
+ *                                                                         *
+ *   You should have received a copy of the GNU Library General Public     *
+ *   License along with this library; see the file COPYING.LIB. If not,    *
+ *   write to the Free Software Foundation, Inc., 59 Temple Place,         *
+ *   Suite 330, Boston, MA  02111-1307, USA                                *
+ *                                                                         *
+ ***************************************************************************/
+
+#pragma once
+
+#include <Mod/TechDraw/TechDrawGlobal.h>
+
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include <TopoDS_Shape.hxx>
+#include <gp_Ax2.hxx>
+
+namespace TechDraw
+{
+
+//! a cache of hidden line removal results, shared by all views of all documents.
+//! The results are stored as packed by GeometryObject::packHLR and are looked up
+//! by a hash of the projected shape and the parameters of the projection, so views
+//! whose source geometry and direction are unchanged skip the HLR process.
+class TechDrawExport HLRCache
+{
+public:
+    //! a cache keeping the maxEntries most recently used results
+    explicit HLRCache(size_t maxEntries);
+
+    //! the cache shared by all views, sized by the HLRCacheSize preference
+    static HLRCache& instance();
+
+    //! returns a key for the HLR result of shape, or an empty string if it can't be cached
+    static std::string makeKey(const TopoDS_Shape& shape, const gp_Ax2& viewAxis, int isoCount,
+                               bool isPerspective, double focus);
+
+    bool find(const std::string& key, TopoDS_Shape& result);
+    void insert(const std::string& key, const TopoDS_Shape& result);
+    void clear();
+
+private:
+    using Entry = std::pair<std::string, TopoDS_Shape>;
+
+    std::mutex m_mutex;
+    std::list<Entry> m_entries;    //most recently used first
+    std::unordered_map<std::string, std::list<Entry>::iterator> m_index;
+    size_t m_maxEntries;
+};
+
+}//namespace TechDraw
@@ -454,6 +454,24 @@ bool Preferences::SectionUsePreviousCut()
     return getPreferenceGroup("General")->GetBool("SectionUsePreviousCut", false);
 }
 
+//! true if the hidden lines of separable groups of solids should be removed in parallel
+bool Preferences::parallelHLR()
+{
+    return getPreferenceGroup("General")->GetBool("ParallelHLR", false);
+}
+
+//! the number of HLR results kept in memory to skip the HLR process of unchanged views
+int Preferences::hlrCacheSize()
+{
+    return getPreferenceGroup("General")->GetInt("HLRCacheSize", 50);
+}
+
+//! true if the HLR result of a view should be saved with the document
+bool Preferences::persistHLR()
+{
+    return getPreferenceGroup("General")->GetBool("PersistHLR", false);
+}
+
 //! an index into the list of available line standards/version found in LineGroupDirectory
 int Preferences::lineStandard()
 {
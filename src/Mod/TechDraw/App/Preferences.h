@@ -112,6 +112,9 @@ public:
 
     static double svgHatchFactor();
     static bool SectionUsePreviousCut();
+    static bool parallelHLR();
+    static int hlrCacheSize();
+    static bool persistHLR();
 
     static int lineStandard();
     static void setLineStandard(int index);
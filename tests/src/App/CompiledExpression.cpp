@@ -0,0 +1,132 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include "Base/Quantity.h"
+
+#include "App/Application.h"
+#include "App/CompiledExpression.h"
+#include "App/Document.h"
+#include "App/Expression.h"
+#include "App/FeatureTest.h"
+
+#include "src/App/InitApplication.h"
+
+class CompiledExpressionTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    void SetUp() override
+    {
+        _docName = App::GetApplication().getUniqueDocumentName("test");
+        _doc = App::GetApplication().newDocument(_docName.c_str(), "testUser");
+        _obj = _doc->addObject("App::FeatureTest", "Test");
+    }
+
+    void TearDown() override
+    {
+        App::GetApplication().closeDocument(_docName.c_str());
+    }
+
+    std::shared_ptr<App::CompiledExpression> compile(const std::string& text)
+    {
+        std::shared_ptr<const App::Expression> expr = App::Expression::parse(_obj, text);
+        return App::CompiledExpression::compile(expr);
+    }
+
+    // Check that the compiled expression gives exactly what the regular evaluation gives
+    void expectSameValue(const std::string& text)
+    {
+        SCOPED_TRACE(text);
+        auto compiled = compile(text);
+        ASSERT_TRUE(compiled->isValid());
+
+        App::any value;
+        ASSERT_TRUE(compiled->evaluate(value));
+        App::any expected = compiled->getExpression()->getValueAsAny();
+        ASSERT_EQ(value.type(), expected.type());
+        if (expected.type() == typeid(Base::Quantity)) {
+            const auto& q1 = App::any_cast<const Base::Quantity&>(value);
+            const auto& q2 = App::any_cast<const Base::Quantity&>(expected);
+            EXPECT_EQ(q1.getUnit(), q2.getUnit());
+            EXPECT_DOUBLE_EQ(q1.getValue(), q2.getValue());
+        }
+        else if (expected.type() == typeid(double)) {
+            EXPECT_DOUBLE_EQ(App::any_cast<double>(value), App::any_cast<double>(expected));
+        }
+        else {
+            EXPECT_EQ(App::any_cast<long>(value), App::any_cast<long>(expected));
+        }
+    }
+
+    App::DocumentObject* obj()
+    {
+        return _obj;
+    }
+
+private:
+    std::string _docName;
+    App::Document* _doc {};
+    App::DocumentObject* _obj {};
+};
+
+TEST_F(CompiledExpressionTest, constants)
+{
+    expectSameValue("1 + 2");
+    expectSameValue("7 / 2");
+    expectSameValue("-7 % 3");
+    expectSameValue("2 ^ 10");
+    expectSameValue("2 ^ -1");
+    expectSameValue("1.5 * 2");
+    expectSameValue("pi * 2");
+    expectSameValue("True + True");
+    expectSameValue("3 mm * 2");
+    expectSameValue("10 mm % 3");
+    expectSameValue("(2 mm) ^ 2");
+    expectSameValue("1 m + 5 mm");
+    expectSameValue("1 < 2");
+    expectSameValue("1 m > 5 mm");
+}
+
+TEST_F(CompiledExpressionTest, properties)
+{
+    expectSameValue("Integer + 1");
+    expectSameValue("Integer / 2");
+    expectSameValue("Float * 2");
+    expectSameValue("Bool + 1");
+    expectSameValue("Distance * 2 + 1 mm");
+    expectSameValue("Distance / Distance");
+    expectSameValue("Integer > 100 ? Distance : 2 mm");
+    expectSameValue("Integer < 100 ? Distance : 2 mm");
+}
+
+TEST_F(CompiledExpressionTest, functions)
+{
+    expectSameValue("sin(Angle)");
+    expectSameValue("sqrt(Distance * Distance)");
+    expectSameValue("hypot(3 mm; 4 mm)");
+    expectSameValue("abs(-Integer)");
+    expectSameValue("round(Float)");
+    expectSameValue("atan2(1; 1)");
+}
+
+TEST_F(CompiledExpressionTest, fallback)
+{
+    App::any value;
+
+    // Not supported
+    EXPECT_FALSE(compile("<<abc>>")->isValid());
+    EXPECT_FALSE(compile("sum(1; 2; 3)")->isValid());
+    EXPECT_FALSE(compile("String")->isValid() && compile("String")->evaluate(value));
+
+    // Errors are left to the regular evaluation
+    EXPECT_FALSE(compile("1 / 0")->evaluate(value));
+    EXPECT_FALSE(compile("1 mm + 1")->evaluate(value));
+    EXPECT_FALSE(compile("Distance + Angle")->evaluate(value));
+    EXPECT_FALSE(compile("5 % Distance")->evaluate(value));
+    EXPECT_FALSE(compile("(-8) ^ 0.5")->evaluate(value));
+}
@@ -3,11 +3,21 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+
 #include "App/Application.h"
 #include "App/Document.h"
+#include "App/DocumentObject.h"
+#include "App/PropertyFile.h"
 #include "App/StringHasher.h"
+#include "Base/FileInfo.h"
+#include "Base/Uuid.h"
 #include "Base/Writer.h"
 #include <src/App/InitApplication.h>
+#include <zipios++/zipfile.h>
 
 using ::testing::Eq;
 using ::testing::Ne;
@@ -94,4 +104,127 @@ TEST_F(DocumentTest, getStringHasherGivesExpectedHasher)
     EXPECT_EQ(hasher, foundHasher);
 }
 
+namespace
+{
+void writeText(const std::string& fileName, const std::string& text)
+{
+    Base::FileInfo(fileName).setPermissions(Base::FileInfo::ReadWrite);
+    std::ofstream(fileName, std::ios::out | std::ios::binary | std::ios::trunc) << text;
+}
+
+std::string readEntry(const std::string& archiveName, const std::string& name)
+{
+    zipios::ZipFile archive(archiveName);
+    std::unique_ptr<std::istream> str(archive.getInputStream(name));
+    return {std::istreambuf_iterator<char>(*str), std::istreambuf_iterator<char>()};
+}
+}  // namespace
+
+class DocumentSaveTest: public DocumentTest
+{
+protected:
+    void SetUp() override
+    {
+        DocumentTest::SetUp();
+        _dir = std::filesystem::temp_directory_path()
+            / ("DocumentSaveTest" + Base::Uuid::createUuid());
+        std::filesystem::create_directories(_dir);
+
+        auto object = doc()->addObject("App::VarSet", "VarSet");
+        _unchanged = static_cast<App::PropertyFileIncluded*>(
+            object->addDynamicProperty("App::PropertyFileIncluded", "Unchanged"));
+        _changed = static_cast<App::PropertyFileIncluded*>(
+            object->addDynamicProperty("App::PropertyFileIncluded", "Changed"));
+        writeText(path("unchanged.txt"), "first");
+        writeText(path("changed.txt"), "first");
+        _unchanged->setValue(path("unchanged.txt").c_str());
+        _changed->setValue(path("changed.txt").c_str());
+    }
+
+    void TearDown() override
+    {
+        DocumentTest::TearDown();
+        std::filesystem::remove_all(_dir);
+    }
+
+    std::string path(const char* name) const
+    {
+        return (_dir / name).string();
+    }
+
+    App::PropertyFileIncluded* unchanged()
+    {
+        return _unchanged;
+    }
+
+    App::PropertyFileIncluded* changed()
+    {
+        return _changed;
+    }
+
+private:
+    std::filesystem::path _dir;
+    App::PropertyFileIncluded* _unchanged {};
+    App::PropertyFileIncluded* _changed {};
+};
+
+TEST_F(DocumentSaveTest, saveWritesFilesChangedInPlace)
+{
+    // Arrange
+    std::string fileName = path("Incremental.FCStd");
+    ASSERT_TRUE(doc()->saveAs(fileName.c_str()));
+    EXPECT_TRUE(unchanged()->isDocFileUnchanged());
+    // Changing the file behind the back of the property doesn't reset its Saved bit
+    writeText(unchanged()->getValue(), "modified");
+    writeText(path("second.txt"), "second");
+    changed()->setValue(path("second.txt").c_str());
+    EXPECT_TRUE(unchanged()->testStatus(App::Property::Saved));
+    EXPECT_FALSE(unchanged()->isDocFileUnchanged());
+    EXPECT_FALSE(changed()->testStatus(App::Property::Saved));
+
+    // Act
+    ASSERT_TRUE(doc()->save());
+
+    // Assert
+    EXPECT_EQ(readEntry(fileName, Base::FileInfo(unchanged()->getValue()).fileName()), "modified");
+    EXPECT_EQ(readEntry(fileName, Base::FileInfo(changed()->getValue()).fileName()), "second");
+    EXPECT_TRUE(unchanged()->testStatus(App::Property::Saved));
+    EXPECT_TRUE(unchanged()->isDocFileUnchanged());
+    EXPECT_TRUE(changed()->testStatus(App::Property::Saved));
+}
+
+TEST_F(DocumentSaveTest, saveKeepsUnchangedFiles)
+{
+    // Arrange
+    std::string fileName = path("Unchanged.FCStd");
+    ASSERT_TRUE(doc()->saveAs(fileName.c_str()));
+    writeText(path("second.txt"), "second");
+    changed()->setValue(path("second.txt").c_str());
+
+    // Act
+    ASSERT_TRUE(doc()->save());
+
+    // Assert
+    EXPECT_EQ(readEntry(fileName, Base::FileInfo(unchanged()->getValue()).fileName()), "first");
+    EXPECT_EQ(readEntry(fileName, Base::FileInfo(changed()->getValue()).fileName()), "second");
+}
+
+TEST_F(DocumentSaveTest, saveDoesNotWriteSavedStatus)
+{
+    // Arrange
+    std::string fileName = path("Status.FCStd");
+    ASSERT_TRUE(doc()->saveAs(fileName.c_str()));
+    ASSERT_TRUE(unchanged()->testStatus(App::Property::Saved));
+    auto status = unchanged()->getStatus();
+
+    // Act
+    ASSERT_TRUE(doc()->save());
+
+    // Assert
+    std::string xml = readEntry(fileName, "Document.xml");
+    EXPECT_EQ(xml.find("status=\"" + std::to_string(status) + "\""), std::string::npos);
+    EXPECT_NE(xml.find("status=\"" + std::to_string(status & ~(1UL << App::Property::Saved)) + "\""),
+              std::string::npos);
+}
+
 // NOLINTEND(readability-magic-numbers)
@@ -0,0 +1,124 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "App/Application.h"
+#include "App/Document.h"
+#include "App/FeatureTest.h"
+#include <src/App/InitApplication.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class ParallelRecomputeTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    void SetUp() override
+    {
+        _docName = App::GetApplication().getUniqueDocumentName("parallel_recompute");
+        _doc = App::GetApplication().newDocument(_docName.c_str(), "testUser");
+        _hGrp = App::GetApplication().GetParameterGroupByPath(
+            "User parameter:BaseApp/Preferences/Document"
+        );
+        App::FeatureTestConcurrent::executionOrder.clear();
+    }
+
+    void TearDown() override
+    {
+        _hGrp->RemoveBool("EnableParallelRecompute");
+        if (App::GetApplication().getDocument(_docName.c_str())) {
+            App::GetApplication().closeDocument(_docName.c_str());
+        }
+    }
+
+    App::FeatureTestConcurrent* addFeature(const char* name,
+                                           long input,
+                                           App::FeatureTestConcurrent* source = nullptr)
+    {
+        auto feature = static_cast<App::FeatureTestConcurrent*>(
+            _doc->addObject("App::FeatureTestConcurrent", name)
+        );
+        feature->Input.setValue(input);
+        feature->Source.setValue(source);
+        _features.push_back(feature);
+        return feature;
+    }
+
+    std::vector<std::string> recomputeAll(bool parallel)
+    {
+        _hGrp->SetBool("EnableParallelRecompute", parallel);
+        for (auto feature : _features) {
+            feature->touch();
+        }
+        App::FeatureTestConcurrent::executionOrder.clear();
+        _doc->recompute();
+        return App::FeatureTestConcurrent::executionOrder;
+    }
+
+    std::string _docName;
+    App::Document* _doc {};
+    ParameterGrp::handle _hGrp;
+    std::vector<App::FeatureTestConcurrent*> _features;
+};
+
+TEST_F(ParallelRecomputeTest, appliesResultsInTopologicalOrder)
+{
+    auto a = addFeature("A", 1);
+    addFeature("B", 2);
+    addFeature("C", 3);
+    auto d = addFeature("D", 10, a);
+    auto e = addFeature("E", 100, d);
+    addFeature("F", 5);
+
+    auto serialOrder = recomputeAll(false);
+    auto parallelOrder = recomputeAll(true);
+
+    // the objects are still executed one after another in the same order
+    EXPECT_EQ(parallelOrder, serialOrder);
+    EXPECT_EQ(a->Result.getValue(), 1);
+    EXPECT_EQ(d->Result.getValue(), 11);
+    EXPECT_EQ(e->Result.getValue(), 111);
+
+    int concurrent = 0;
+    for (auto feature : _features) {
+        if (feature->computedConcurrently) {
+            ++concurrent;
+        }
+    }
+    EXPECT_GE(concurrent, 2);
+}
+
+TEST_F(ParallelRecomputeTest, disabledByDefault)
+{
+    addFeature("A", 1);
+    addFeature("B", 2);
+
+    _hGrp->RemoveBool("EnableParallelRecompute");
+    _doc->recompute();
+
+    for (auto feature : _features) {
+        EXPECT_FALSE(feature->computedConcurrently);
+        EXPECT_EQ(feature->Result.getValue(), feature->Input.getValue());
+    }
+}
+
+TEST_F(ParallelRecomputeTest, changedInputDiscardsComputedResult)
+{
+    auto a = addFeature("A", 1);
+    a->computeConcurrently();
+    a->Input.setValue(7);
+
+    _doc->recompute();
+
+    EXPECT_FALSE(a->computedConcurrently);
+    EXPECT_EQ(a->Result.getValue(), 7);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -12,12 +12,15 @@
 #include "Base/Exception.h"
 #include "Base/Persistence.h"
 #include "Base/Reader.h"
+#include "Base/Writer.h"
 #include <array>
 #include <filesystem>
 #include <fstream>
 #include <random>
+#include <sstream>
 #include <string>
 #include <xercesc/util/PlatformUtils.hpp>
+#include <zipios++/zipinputstream.h>
 
 namespace fs = std::filesystem;
 
@@ -607,6 +610,153 @@ TEST_F(ReaderTest, MixedContentSanitization)
     EXPECT_EQ(result, expected);
 }
 
+class DocFile: public Base::Persistence
+{
+public:
+    DocFile(std::string content, bool decodable, std::vector<std::string>& restored)
+        : content(std::move(content))
+        , decodable(decodable)
+        , restored(restored)
+    {}
+
+    unsigned int getMemSize() const override
+    {
+        return 0;
+    }
+    void Save(Base::Writer& /*writer*/) const override
+    {}
+    void Restore(Base::XMLReader& /*reader*/) override
+    {}
+    void SaveDocFile(Base::Writer& writer) const override
+    {
+        writer.Stream() << content;
+    }
+    void RestoreDocFile(Base::Reader& reader) override
+    {
+        restored.push_back(readAll(reader));
+    }
+    bool canDecodeDocFile() const override
+    {
+        return decodable;
+    }
+    std::function<void()> decodeDocFile(Base::Reader& reader) override
+    {
+        std::string data = readAll(reader);
+        if (data == "invalid") {
+            throw Base::BadFormatError("invalid data");
+        }
+        return [this, data]() {
+            restored.push_back(data);
+        };
+    }
+
+private:
+    static std::string readAll(Base::Reader& reader)
+    {
+        return {std::istreambuf_iterator<char>(reader), std::istreambuf_iterator<char>()};
+    }
+
+    std::string content;
+    bool decodable;
+    std::vector<std::string>& restored;
+};
+
+class ReaderZip
+{
+public:
+    void givenFiles(const std::vector<std::string>& contents, bool decodable)
+    {
+        for (std::size_t i = 0; i < contents.size(); i++) {
+            // make every third file use the sequential way
+            files.push_back(std::make_unique<DocFile>(contents[i], decodable && i % 3 != 1, restored));
+        }
+
+        Base::ZipWriter writer(buffer);
+        writer.putNextEntry("Document.xml");
+        writer.Stream() << R"(<?xml version="1.0" encoding="UTF-8"?><document/>)";
+        for (std::size_t i = 0; i < files.size(); i++) {
+            std::string name = "File" + std::to_string(i);
+            fileNames.push_back(writer.addFile(name.c_str(), files[i].get()));
+        }
+        writer.writeFiles();
+    }
+
+    std::vector<std::string> restoreFiles(bool concurrent)
+    {
+        zipios::ZipInputStream zipstream(buffer);
+        Base::XMLReader reader("Document.xml", zipstream);
+        reader.setConcurrentRestore(concurrent);
+        for (std::size_t i = 0; i < files.size(); i++) {
+            reader.addFile(fileNames[i].c_str(), files[i].get());
+        }
+        reader.readFiles(zipstream);
+        for (const auto& name : fileNames) {
+            if (reader.hasReadFailed(name)) {
+                failed.push_back(name);
+            }
+        }
+        return restored;
+    }
+
+    const std::vector<std::string>& failedFiles() const
+    {
+        return failed;
+    }
+
+private:
+    std::stringstream buffer;
+    std::vector<std::unique_ptr<DocFile>> files;
+    std::vector<std::string> fileNames;
+    std::vector<std::string> restored;
+    std::vector<std::string> failed;
+};
+
+TEST_F(ReaderTest, readFilesConcurrentKeepsOrder)
+{
+    // Arrange
+    std::vector<std::string> contents;
+    for (int i = 0; i < 50; i++) {
+        contents.push_back(std::string(1000 * i, 'x') + std::to_string(i));
+    }
+    ReaderZip zip;
+    zip.givenFiles(contents, true);
+
+    // Act
+    auto result = zip.restoreFiles(true);
+
+    // Assert
+    EXPECT_EQ(result, contents);
+    EXPECT_TRUE(zip.failedFiles().empty());
+}
+
+TEST_F(ReaderTest, readFilesConcurrentReportsFailure)
+{
+    // Arrange
+    ReaderZip zip;
+    zip.givenFiles({"first", "second", "third", "invalid", "fifth"}, true);
+
+    // Act
+    auto result = zip.restoreFiles(true);
+
+    // Assert
+    EXPECT_EQ(result, (std::vector<std::string> {"first", "second", "third", "fifth"}));
+    EXPECT_EQ(zip.failedFiles(), (std::vector<std::string> {"File3"}));
+}
+
+TEST_F(ReaderTest, readFilesSequential)
+{
+    // Arrange
+    ReaderZip zip;
+    zip.givenFiles({"first", "invalid", "third"}, true);
+
+    // Act
+    auto result = zip.restoreFiles(false);
+
+    // Assert
+    EXPECT_EQ(result, (std::vector<std::string> {"first", "invalid", "third"}));
+    EXPECT_TRUE(zip.failedFiles().empty());
+}
+
 TEST_F(ReaderTest, validateXmlString)
 {
     std::string input = "abcde";
@@ -3,7 +3,14 @@
 #include <gtest/gtest.h>
 
 #include "Base/Exception.h"
+#include "Base/FileInfo.h"
+#include "Base/Persistence.h"
+#include "Base/Stream.h"
 #include "Base/Writer.h"
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <zipios++/zipfile.h>
 
 // Writer is designed to be a base class, so for testing we actually instantiate a StringWriter,
 // which is derived from it
@@ -129,3 +136,139 @@ TEST_F(WriterTest, charStreamBase64Encoded)
     // Conversion done using https://www.base64encode.org for testing purposes
     EXPECT_EQ(std::string("RnJlZUNBRCByb2NrcyEg8J+qqPCfqqjwn6qo\n"), _writer.getString());
 }
+
+namespace
+{
+class DocFile: public Base::Persistence
+{
+public:
+    explicit DocFile(std::string content)
+        : content(std::move(content))
+    {}
+    unsigned int getMemSize() const override
+    {
+        return static_cast<unsigned int>(content.size());
+    }
+    void Save(Base::Writer& /*writer*/) const override
+    {}
+    void Restore(Base::XMLReader& /*reader*/) override
+    {}
+    void SaveDocFile(Base::Writer& writer) const override
+    {
+        writer.Stream() << content;
+    }
+
+    std::string content;
+};
+
+std::vector<std::string> writeArchive(
+    const std::string& fileName,
+    const std::vector<std::unique_ptr<DocFile>>& files,
+    const std::string& previous = {},
+    const DocFile* unchanged = nullptr,
+    bool parallel = true
+)
+{
+    Base::ofstream file(Base::FileInfo(fileName), std::ios::out | std::ios::binary);
+    Base::ZipWriter writer(file);
+    writer.setParallelCompression(parallel);
+    if (!previous.empty()) {
+        writer.setPreviousArchive(
+            previous,
+            [unchanged](const Base::Persistence* object, const std::string& /*fileName*/) {
+                return object == unchanged;
+            }
+        );
+    }
+    writer.putNextEntry("Document.xml");
+    writer.Stream() << "<Document/>";
+    std::vector<std::string> names;
+    for (const auto& file : files) {
+        names.push_back(writer.addFile("File.txt", file.get()));
+    }
+    writer.writeFiles();
+    return names;
+}
+
+std::string readEntry(zipios::ZipFile& archive, const std::string& name)
+{
+    std::unique_ptr<std::istream> str(archive.getInputStream(name));
+    return {std::istreambuf_iterator<char>(*str), std::istreambuf_iterator<char>()};
+}
+}  // namespace
+
+TEST(ZipWriterTest, previousArchiveCopiesUnchangedFiles)
+{
+    // Arrange
+    std::string first = Base::FileInfo::getTempFileName();
+    std::string second = Base::FileInfo::getTempFileName();
+    std::vector<std::unique_ptr<DocFile>> files;
+    files.push_back(std::make_unique<DocFile>(std::string(10000, 'a')));
+    files.push_back(std::make_unique<DocFile>("second"));
+    writeArchive(first, files);
+
+    // The content of an unchanged file must not be written again
+    files[0]->content = "modified";
+    files[1]->content = "modified";
+
+    // Act
+    auto names = writeArchive(second, files, first, files[0].get());
+
+    // Assert
+    zipios::ZipFile archive(second);
+    EXPECT_EQ(readEntry(archive, "Document.xml"), "<Document/>");
+    EXPECT_EQ(readEntry(archive, names[0]), std::string(10000, 'a'));
+    EXPECT_EQ(readEntry(archive, names[1]), "modified");
+    archive.close();
+    Base::FileInfo(first).deleteFile();
+    Base::FileInfo(second).deleteFile();
+}
+
+TEST(ZipWriterTest, parallelCompressionStreamsLargeFiles)
+{
+    // Arrange
+    std::string fileName = Base::FileInfo::getTempFileName();
+    std::string large(40 * 1024 * 1024, 'x');
+    large.back() = 'y';
+    std::vector<std::unique_ptr<DocFile>> files;
+    files.push_back(std::make_unique<DocFile>("first"));
+    files.push_back(std::make_unique<DocFile>(large));
+    files.push_back(std::make_unique<DocFile>("third"));
+
+    // Act
+    auto names = writeArchive(fileName, files);
+
+    // Assert
+    zipios::ZipFile archive(fileName);
+    ASSERT_EQ(archive.size(), 4);
+    auto entries = archive.entries();
+    EXPECT_EQ(entries[0]->getName(), "Document.xml");
+    EXPECT_EQ(entries[1]->getName(), names[0]);
+    EXPECT_EQ(entries[2]->getName(), names[1]);
+    EXPECT_EQ(entries[3]->getName(), names[2]);
+    EXPECT_EQ(readEntry(archive, names[0]), "first");
+    EXPECT_EQ(readEntry(archive, names[1]), large);
+    EXPECT_EQ(readEntry(archive, names[2]), "third");
+    archive.close();
+    Base::FileInfo(fileName).deleteFile();
+}
+
+TEST(ZipWriterTest, writeFilesWithoutParallelCompression)
+{
+    // Arrange
+    std::string fileName = Base::FileInfo::getTempFileName();
+    std::vector<std::unique_ptr<DocFile>> files;
+    files.push_back(std::make_unique<DocFile>("first"));
+    files.push_back(std::make_unique<DocFile>(std::string(10000, 'a')));
+
+    // Act
+    auto names = writeArchive(fileName, files, {}, nullptr, false);
+
+    // Assert
+    zipios::ZipFile archive(fileName);
+    EXPECT_EQ(readEntry(archive, "Document.xml"), "<Document/>");
+    EXPECT_EQ(readEntry(archive, names[0]), "first");
+    EXPECT_EQ(readEntry(archive, names[1]), std::string(10000, 'a'));
+    archive.close();
+    Base::FileInfo(fileName).deleteFile();
+}
@@ -0,0 +1,61 @@
+#include <gtest/gtest.h>
+#include <Mod/CAM/App/Command.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+TEST(CommandTest, parametersKeepMapOrder)
+{
+    Path::Command cmd("G1", {{"Y", 2.0}, {"X", 1.0}, {"XA", 3.0}, {"(", 4.0}, {"F", 5.0}});
+    std::vector<std::string> keys;
+    for (const auto& [key, value] : cmd.Parameters) {
+        keys.push_back(key);
+    }
+    EXPECT_EQ(keys, (std::vector<std::string> {"(", "F", "X", "XA", "Y"}));
+    EXPECT_EQ(cmd.Parameters.size(), 5);
+    EXPECT_DOUBLE_EQ(cmd.getParam("XA"), 3.0);
+    EXPECT_DOUBLE_EQ(cmd.getParam('Y'), 2.0);
+    EXPECT_DOUBLE_EQ(cmd.getParam('Z', -1.0), -1.0);
+}
+
+TEST(CommandTest, parametersSpillManyLetters)
+{
+    Path::Command cmd;
+    const std::string letters = "ZYXWVUTSRQPONMLKJIHGFEDCBA";
+    for (std::size_t i = 0; i < letters.size(); ++i) {
+        cmd.Parameters[letters[i]] = double(i);
+    }
+    EXPECT_EQ(cmd.Parameters.size(), letters.size());
+    for (std::size_t i = 0; i < letters.size(); ++i) {
+        EXPECT_DOUBLE_EQ(cmd.getParam(letters[i]), double(i));
+    }
+
+    for (char letter : std::string("ACEGIKMOQSUWY")) {
+        EXPECT_EQ(cmd.Parameters.erase(std::string(1, letter)), 1);
+    }
+    cmd.Parameters['A'] = 100.0;
+    EXPECT_EQ(cmd.Parameters.size(), 14);
+    EXPECT_DOUBLE_EQ(cmd.getParam('A'), 100.0);
+    EXPECT_DOUBLE_EQ(cmd.getParam('B'), 24.0);
+    EXPECT_FALSE(cmd.has('C'));
+    EXPECT_DOUBLE_EQ(cmd.getParam('Z'), 0.0);
+}
+
+TEST(CommandTest, parametersFind)
+{
+    Path::Command cmd("G1", {{"X", 1.0}, {"XA", 2.0}, {"Z", 3.0}});
+    auto it = cmd.Parameters.find("XA");
+    ASSERT_NE(it, cmd.Parameters.end());
+    EXPECT_DOUBLE_EQ(it->second, 2.0);
+    ++it;
+    ASSERT_NE(it, cmd.Parameters.end());
+    EXPECT_EQ(it->first, "Z");
+    EXPECT_EQ(cmd.Parameters.find("Y"), cmd.Parameters.end());
+    EXPECT_EQ(cmd.Parameters.find("XB"), cmd.Parameters.end());
+}
+
+TEST(CommandTest, toGCode)
+{
+    Path::Command cmd;
+    cmd.setFromGCode("G2 Y-2 X1.5 J0.5 I-1 F300");
+    EXPECT_EQ(cmd.toGCode(3, false), "G2 F300 I-1 J0.5 X1.5 Y-2");
+}
+// NOLINTEND(cppcoreguidelines-*,readability-*)
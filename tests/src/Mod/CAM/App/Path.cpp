@@ -1,4 +1,5 @@
 #include <numbers>
+#include <sstream>
 
 #include <gtest/gtest.h>
 #include <Base/Exception.h>
@@ -195,4 +196,47 @@ TEST(PathTest, assign)
     EXPECT_NEAR(path.getLength(), 2.0 + std::numbers::pi / 2, 1e-12);
     EXPECT_NEAR(path2.getLength(), 2.0 + std::numbers::pi / 2, 1e-12);
 }
+
+TEST(PathTest, largeGCodeRoundTrip)
+{
+    // enough commands to be parsed and formatted in several chunks
+    const int count = 50000;
+    std::string gcode;
+    for (int i = 0; i < count; i++) {
+        if (i == count / 2) {
+            gcode += "G20\n";
+        }
+        gcode += "G1 X" + std::to_string(i) + " Y-0.5 F100\n";
+    }
+
+    Path::Toolpath path;
+    path.setFromGCode(gcode);
+
+    ASSERT_EQ(path.getSize(), count);
+    EXPECT_DOUBLE_EQ(path.getCommand(count / 2 - 1).getParam('X'), count / 2 - 1);
+    EXPECT_DOUBLE_EQ(path.getCommand(count / 2).getParam('X'), 25.4 * (count / 2));
+    EXPECT_DOUBLE_EQ(path.getCommand(count - 1).getParam('Y'), -0.5 * 25.4);
+
+    std::string expected;
+    for (const auto& cmd : path.getCommands()) {
+        expected += cmd.toGCode() + "\n";
+    }
+    EXPECT_EQ(path.toGCode(), expected);
+
+    std::ostringstream stream;
+    path.toGCode(stream);
+    EXPECT_EQ(stream.str(), expected);
+}
+
+TEST(PathTest, setFromBadGCode)
+{
+    std::string gcode;
+    for (int i = 0; i < 20000; i++) {
+        gcode += "G1 X1\n";
+    }
+    gcode += "G1 X\n";
+
+    Path::Toolpath path;
+    EXPECT_THROW(path.setFromGCode(gcode), Base::BadFormatError);
+}
 // NOLINTEND(cppcoreguidelines-*,readability-*)
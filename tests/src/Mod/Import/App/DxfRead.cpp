@@ -0,0 +1,104 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <Base/FileInfo.h>
+#include <Mod/Import/App/dxf/dxf.h>
+
+#include "src/App/InitApplication.h"
+
+namespace
+{
+class PointReader: public CDxfRead
+{
+public:
+    using CDxfRead::CDxfRead;
+
+    void OnReadPoint(const Base::Vector3d& point) override
+    {
+        points.push_back(point);
+    }
+
+    std::vector<Base::Vector3d> points;
+};
+
+std::string point(const std::string& x, const std::string& y)
+{
+    return "0\nPOINT\n10\n" + x + "\n20\n" + y + "\n30\n0\n";
+}
+}  // namespace
+
+class DxfReadTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    void TearDown() override
+    {
+        std::remove(_fileName.c_str());
+    }
+
+    std::vector<Base::Vector3d> readPoints(const std::string& entities, bool& failed)
+    {
+        _fileName = Base::FileInfo::getTempFileName() + ".dxf";
+        {
+            std::ofstream file(_fileName, std::ios::out | std::ios::binary);
+            // the final record has no line terminator
+            file << "0\nSECTION\n2\nENTITIES\n" << entities << "0\nENDSEC\n0\nEOF";
+        }
+
+        PointReader reader(_fileName);
+        reader.DoRead();
+        failed = reader.Failed();
+        return reader.points;
+    }
+
+private:
+    std::string _fileName;
+};
+
+TEST_F(DxfReadTest, linesSpanBufferRefills)
+{
+    // a comment longer than a read block, followed by enough points to end the following
+    // blocks in the middle of a line
+    std::string entities = "999\n" + std::string(3 << 20, 'x') + "\n";
+    const int count = 100000;
+    for (int i = 0; i < count; i++) {
+        entities += point(std::to_string(i), "-2.5");
+    }
+
+    bool failed = true;
+    auto points = readPoints(entities, failed);
+
+    EXPECT_FALSE(failed);
+    ASSERT_EQ(points.size(), count);
+    for (int i = 0; i < count; i++) {
+        EXPECT_DOUBLE_EQ(points[i].x, i);
+        EXPECT_DOUBLE_EQ(points[i].y, -2.5);
+    }
+}
+
+TEST_F(DxfReadTest, malformedNumbersReadAsZero)
+{
+    std::string entities = point("abc", "1e3") + point(".5", "-") + point("7", "8");
+
+    bool failed = true;
+    auto points = readPoints(entities, failed);
+
+    EXPECT_FALSE(failed);
+    ASSERT_EQ(points.size(), 3);
+    EXPECT_DOUBLE_EQ(points[0].x, 0.0);
+    EXPECT_DOUBLE_EQ(points[0].y, 1000.0);
+    EXPECT_DOUBLE_EQ(points[1].x, 0.5);
+    EXPECT_DOUBLE_EQ(points[1].y, 0.0);
+    EXPECT_DOUBLE_EQ(points[2].x, 7.0);
+    EXPECT_DOUBLE_EQ(points[2].y, 8.0);
+}
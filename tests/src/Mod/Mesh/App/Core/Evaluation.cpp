@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include <Mod/Mesh/App/Core/Degeneration.h>
+#include <Mod/Mesh/App/Core/Elements.h>
+#include <Mod/Mesh/App/Core/Evaluation.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class MeshEvaluationPipelineTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // two triangles sharing an edge and a third one at a non-manifold edge
+        Base::Vector3f p1(0, 0, 0), p2(1, 0, 0), p3(1, 1, 0), p4(0, 1, 0), p5(1, 0, 1);
+        std::vector<MeshCore::MeshGeomFacet> facets;
+        facets.emplace_back(p1, p2, p3);
+        facets.emplace_back(p1, p3, p4);
+        facets.emplace_back(p1, p3, p5);
+        kernel = facets;
+    }
+
+    MeshCore::MeshKernel kernel;
+};
+
+TEST_F(MeshEvaluationPipelineTest, TestEmpty)
+{
+    MeshCore::MeshEvaluationPipeline pipeline(kernel);
+    EXPECT_TRUE(pipeline.Evaluate());
+}
+
+TEST_F(MeshEvaluationPipelineTest, TestResults)
+{
+    MeshCore::MeshEvaluationPipeline pipeline(kernel);
+    auto& topology = pipeline.Add<MeshCore::MeshEvalTopology>();
+    auto& points = pipeline.Add<MeshCore::MeshEvalDuplicatePoints>();
+    auto& degenerated = pipeline.Add<MeshCore::MeshEvalDegeneratedFacets>(0.001F);
+
+    EXPECT_FALSE(pipeline.Evaluate());
+    EXPECT_FALSE(pipeline.IsValid(topology));
+    EXPECT_TRUE(pipeline.IsValid(points));
+    EXPECT_TRUE(pipeline.IsValid(degenerated));
+    EXPECT_EQ(topology.CountManifolds(), 1);
+
+    // same result as the sequential evaluation
+    MeshCore::MeshEvalTopology eval(kernel);
+    EXPECT_EQ(eval.Evaluate(), pipeline.IsValid(topology));
+    EXPECT_EQ(eval.GetIndices(), topology.GetIndices());
+}
+
+class MeshEvalSelfIntersectionTest: public ::testing::Test
+{
+protected:
+    // Create a planar grid with two triangles per cell
+    static std::vector<MeshCore::MeshGeomFacet> CreateGrid(int cols, int rows)
+    {
+        std::vector<MeshCore::MeshGeomFacet> facets;
+        for (int i = 0; i < cols; i++) {
+            for (int j = 0; j < rows; j++) {
+                Base::Vector3f p1(float(i), float(j), 0.F);
+                Base::Vector3f p2(float(i + 1), float(j), 0.F);
+                Base::Vector3f p3(float(i + 1), float(j + 1), 0.F);
+                Base::Vector3f p4(float(i), float(j + 1), 0.F);
+                facets.emplace_back(p1, p2, p3);
+                facets.emplace_back(p1, p3, p4);
+            }
+        }
+        return facets;
+    }
+};
+
+TEST_F(MeshEvalSelfIntersectionTest, TestNoIntersection)
+{
+    MeshCore::MeshKernel kernel;
+    kernel = CreateGrid(100, 100);
+
+    MeshCore::MeshEvalSelfIntersection eval(kernel);
+    EXPECT_TRUE(eval.Evaluate());
+
+    std::vector<std::pair<MeshCore::FacetIndex, MeshCore::FacetIndex>> intersection;
+    eval.GetIntersections(intersection);
+    EXPECT_TRUE(intersection.empty());
+}
+
+TEST_F(MeshEvalSelfIntersectionTest, TestIntersection)
+{
+    // a vertical triangle that cuts through the grid
+    std::vector<MeshCore::MeshGeomFacet> facets = CreateGrid(100, 100);
+    facets.emplace_back(
+        Base::Vector3f(50.2F, 50.5F, -1.F),
+        Base::Vector3f(50.8F, 50.5F, -1.F),
+        Base::Vector3f(50.5F, 50.5F, 1.F)
+    );
+
+    MeshCore::MeshKernel kernel;
+    kernel = facets;
+
+    MeshCore::MeshEvalSelfIntersection eval(kernel);
+    EXPECT_FALSE(eval.Evaluate());
+
+    std::vector<std::pair<MeshCore::FacetIndex, MeshCore::FacetIndex>> intersection;
+    eval.GetIntersections(intersection);
+    ASSERT_FALSE(intersection.empty());
+
+    MeshCore::FacetIndex last = kernel.CountFacets() - 1;
+    for (const auto& it : intersection) {
+        EXPECT_TRUE(it.first == last || it.second == last);
+    }
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
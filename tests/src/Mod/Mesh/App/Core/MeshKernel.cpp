@@ -0,0 +1,163 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+#include <Base/Exception.h>
+#include <Base/Matrix.h>
+#include <Mod/Mesh/App/Core/Elements.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class MeshKernelTest: public ::testing::Test
+{
+protected:
+    // Create a planar grid with two triangles per cell
+    static MeshCore::MeshKernel CreateGrid(int cols, int rows)
+    {
+        std::vector<MeshCore::MeshGeomFacet> facets;
+        facets.reserve(2 * cols * rows);
+        for (int i = 0; i < cols; i++) {
+            for (int j = 0; j < rows; j++) {
+                Base::Vector3f p1(float(i), float(j), 0.F);
+                Base::Vector3f p2(float(i + 1), float(j), 0.F);
+                Base::Vector3f p3(float(i + 1), float(j + 1), 0.F);
+                Base::Vector3f p4(float(i), float(j + 1), 0.F);
+                facets.emplace_back(p1, p2, p3);
+                facets.emplace_back(p1, p3, p4);
+            }
+        }
+
+        MeshCore::MeshKernel kernel;
+        kernel = facets;
+        return kernel;
+    }
+
+    static void ExpectEqual(const MeshCore::MeshKernel& kernel1, const MeshCore::MeshKernel& kernel2)
+    {
+        ASSERT_EQ(kernel1.CountPoints(), kernel2.CountPoints());
+        ASSERT_EQ(kernel1.CountFacets(), kernel2.CountFacets());
+
+        const auto& points1 = kernel1.GetPoints();
+        const auto& points2 = kernel2.GetPoints();
+        for (std::size_t i = 0; i < points1.size(); i++) {
+            EXPECT_EQ(points1[i], points2[i]);
+        }
+
+        const auto& facets1 = kernel1.GetFacets();
+        const auto& facets2 = kernel2.GetFacets();
+        for (std::size_t i = 0; i < facets1.size(); i++) {
+            for (int j = 0; j < 3; j++) {
+                EXPECT_EQ(facets1[i]._aulPoints[j], facets2[i]._aulPoints[j]);
+                EXPECT_EQ(facets1[i]._aulNeighbours[j], facets2[i]._aulNeighbours[j]);
+            }
+        }
+    }
+};
+
+TEST_F(MeshKernelTest, TestWriteReadEmpty)
+{
+    MeshCore::MeshKernel kernel;
+    std::stringstream str;
+    kernel.Write(str);
+
+    MeshCore::MeshKernel copy = CreateGrid(1, 1);
+    copy.Read(str);
+    EXPECT_EQ(copy.CountPoints(), 0);
+    EXPECT_EQ(copy.CountFacets(), 0);
+}
+
+TEST_F(MeshKernelTest, TestWriteRead)
+{
+    // more facets than converted in one block
+    MeshCore::MeshKernel kernel = CreateGrid(300, 120);
+    std::stringstream str;
+    kernel.Write(str);
+
+    MeshCore::MeshKernel copy;
+    copy.Read(str);
+    ExpectEqual(kernel, copy);
+    EXPECT_EQ(copy.GetBoundBox().MaxX, 300.F);
+}
+
+TEST_F(MeshKernelTest, TestReadTruncated)
+{
+    MeshCore::MeshKernel kernel = CreateGrid(10, 10);
+    std::stringstream str;
+    kernel.Write(str);
+
+    std::string data = str.str();
+    std::stringstream truncated(data.substr(0, data.size() / 2));
+    MeshCore::MeshKernel copy;
+    EXPECT_THROW(copy.Read(truncated), Base::BadFormatError);
+}
+
+TEST_F(MeshKernelTest, TestTransformLarge)
+{
+    // large enough to be processed by several threads
+    MeshCore::MeshKernel kernel = CreateGrid(500, 500);
+
+    Base::Matrix4D mat;
+    mat.scale(2.0, 1.0, 1.0);
+    mat.move(Base::Vector3d(-1.0, 2.0, 3.0));
+    kernel.Transform(mat);
+
+    Base::BoundBox3f box = kernel.GetBoundBox();
+    EXPECT_FLOAT_EQ(box.MinX, -1.F);
+    EXPECT_FLOAT_EQ(box.MaxX, 999.F);
+    EXPECT_FLOAT_EQ(box.MinY, 2.F);
+    EXPECT_FLOAT_EQ(box.MaxY, 502.F);
+    EXPECT_FLOAT_EQ(box.MinZ, 3.F);
+    EXPECT_FLOAT_EQ(box.MaxZ, 3.F);
+
+    kernel.RecalcBoundBox();
+    EXPECT_EQ(kernel.GetBoundBox().MaxX, box.MaxX);
+    EXPECT_FLOAT_EQ(kernel.GetSurface(), 500000.F);
+}
+
+TEST_F(MeshKernelTest, TestNormalsLarge)
+{
+    MeshCore::MeshKernel kernel = CreateGrid(500, 500);
+
+    std::vector<MeshCore::FacetIndex> facets {0, 1, kernel.CountFacets() - 1};
+    for (const auto& normal : kernel.GetFacetNormals(facets)) {
+        EXPECT_EQ(normal, Base::Vector3f(0.F, 0.F, 1.F));
+    }
+
+    std::vector<Base::Vector3f> normals = kernel.CalcVertexNormals();
+    ASSERT_EQ(normals.size(), kernel.CountPoints());
+    for (const auto& normal : normals) {
+        EXPECT_EQ(normal.x, 0.F);
+        EXPECT_EQ(normal.y, 0.F);
+        EXPECT_GT(normal.z, 0.F);
+    }
+
+    EXPECT_FLOAT_EQ(kernel.GetSurface(facets), 1.5F);
+    EXPECT_FLOAT_EQ(kernel.GetVolume(), 0.F);
+}
+
+TEST_F(MeshKernelTest, TestVolume)
+{
+    // a unit cube
+    std::vector<Base::Vector3f> p;
+    for (int i = 0; i < 8; i++) {
+        p.emplace_back(float(((i + 1) / 2) % 2), float((i / 2) % 2), float(i / 4));
+    }
+    const int indices[12][3] = {
+        {0, 2, 1}, {0, 3, 2}, {4, 5, 6}, {4, 6, 7}, {0, 1, 5}, {0, 5, 4},
+        {1, 2, 6}, {1, 6, 5}, {2, 3, 7}, {2, 7, 6}, {3, 0, 4}, {3, 4, 7}
+    };
+    std::vector<MeshCore::MeshGeomFacet> facets;
+    for (const auto& index : indices) {
+        facets.emplace_back(p[index[0]], p[index[1]], p[index[2]]);
+    }
+
+    MeshCore::MeshKernel kernel;
+    kernel = facets;
+    EXPECT_FLOAT_EQ(kernel.GetVolume(), 1.F);
+    EXPECT_FLOAT_EQ(kernel.GetSurface(), 6.F);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
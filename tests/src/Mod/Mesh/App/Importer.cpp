@@ -4,6 +4,9 @@
 #include <Base/FileInfo.h>
 #include <Mod/Mesh/App/Core/IO/Reader3MF.h>
 #include <Mod/Mesh/App/Core/IO/ReaderOBJ.h>
+#include <Mod/Mesh/App/Core/MeshIO.h>
+#include <Mod/Mesh/App/Core/MeshKernel.h>
+#include <sstream>
 #include <xercesc/util/PlatformUtils.hpp>
 #include <zipios++/fcoll.h>
 
@@ -53,4 +56,49 @@ TEST_F(ImporterTest, TestOBJ)
     EXPECT_EQ(kernel.CountPoints(), 8);
     EXPECT_EQ(kernel.CountFacets(), 12);
 }
+
+TEST_F(ImporterTest, TestAsciiSTL)
+{
+    std::stringstream str;
+    str << "solid tetrahedron\r\n";
+    const float points[4][3] = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {0, 0, 1}};
+    const int facets[4][3] = {{0, 2, 1}, {0, 1, 3}, {1, 2, 3}, {0, 3, 2}};
+    for (const auto& facet : facets) {
+        str << "  facet normal 0 0 0\r\n    outer loop\r\n";
+        for (int index : facet) {
+            str << "      Vertex " << points[index][0] << " " << points[index][1] << " "
+                << points[index][2] << "  \r\n";
+        }
+        str << "    endloop\r\n  endfacet\r\n";
+    }
+    // no line break at the end
+    str << "endsolid tetrahedron";
+
+    MeshCore::MeshKernel kernel;
+    MeshCore::MeshInput input(kernel);
+    EXPECT_EQ(input.LoadAsciiSTL(str), true);
+
+    EXPECT_EQ(kernel.CountPoints(), 4);
+    EXPECT_EQ(kernel.CountFacets(), 4);
+}
+
+TEST_F(ImporterTest, TestAsciiSTLSkipsMalformedVertices)
+{
+    std::stringstream str;
+    str << "solid test\n"
+           "vertex 0 0 0\n"
+           "vertex 1 0 0 1\n"
+           "vertex 1 0\n"
+           "vertexx 1 1 1\n"
+           "vertex 1.0e0 0 0\n"
+           "VERTEX\t0 +1 0\n"
+           "endsolid test\n";
+
+    MeshCore::MeshKernel kernel;
+    MeshCore::MeshInput input(kernel);
+    EXPECT_EQ(input.LoadAsciiSTL(str), true);
+
+    EXPECT_EQ(kernel.CountPoints(), 3);
+    EXPECT_EQ(kernel.CountFacets(), 1);
+}
 // NOLINTEND(cppcoreguidelines-*,readability-*)
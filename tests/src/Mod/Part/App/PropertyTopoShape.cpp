@@ -2,8 +2,15 @@
 
 #include <gtest/gtest.h>
 
+#include <filesystem>
+
 #include <BRepFilletAPI_MakeFillet.hxx>
+#include <zipios++/zipinputstream.h>
+#include <App/Application.h>
+#include <Base/FileInfo.h>
+#include <Base/Stream.h>
 #include "Mod/Part/App/FeaturePartCommon.h"
+#include "Mod/Part/App/PartFeature.h"
 #include "Mod/Part/App/PropertyTopoShape.h"
 #include <src/App/InitApplication.h>
 #include "PartTestHelpers.h"
@@ -252,6 +259,55 @@ TEST_F(PropertyTopoShapeTest, testPropertyShapeCachePyObj)
     Py_XDECREF(pyObjOutErased);
 }
 
+TEST_F(PropertyTopoShapeTest, testSaveSharedShape)
+{
+    // Arrange
+    auto hGrp = App::GetApplication().GetParameterGroupByPath(
+        "User parameter:BaseApp/Preferences/Mod/Part/General"
+    );
+    hGrp->SetBool("ShareIdenticalShapes", true);
+    auto copy1 = _doc->addObject<Part::Feature>("Copy1");
+    copy1->Shape.setValue(_common->Shape.getShape());
+    auto copy2 = _doc->addObject<Part::Feature>("Copy2");
+    copy2->Shape.setValue(_common->Shape.getShape());
+    auto mapSize = copy2->Shape.getShape().getElementMapSize();
+    std::string fileName = (std::filesystem::temp_directory_path() / (_docName + ".FCStd")).string();
+
+    // Act
+    _doc->saveAs(fileName.c_str());
+    hGrp->RemoveBool("ShareIdenticalShapes");
+
+    int brepFiles = 0;
+    {
+        Base::ifstream file(Base::FileInfo(fileName), std::ios::in | std::ios::binary);
+        zipios::ZipInputStream zipstream(file);
+        for (auto entry = zipstream.getNextEntry(); entry->isValid();
+             entry = zipstream.getNextEntry()) {
+            if (Base::FileInfo(entry->getName()).hasExtension("brp")) {
+                brepFiles++;
+            }
+        }
+    }
+
+    std::string commonName = _common->getNameInDocument();
+    App::GetApplication().closeDocument(_doc->getName());
+    _doc = App::GetApplication().openDocument(fileName.c_str());
+    auto common = dynamic_cast<Part::Feature*>(_doc->getObject(commonName.c_str()));
+    auto restored1 = dynamic_cast<Part::Feature*>(_doc->getObject("Copy1"));
+    auto restored2 = dynamic_cast<Part::Feature*>(_doc->getObject("Copy2"));
+
+    // Assert
+    // one file for each box and one for the shape of the common and its two copies
+    EXPECT_EQ(brepFiles, static_cast<int>(_boxes.size()) + 1);
+    ASSERT_TRUE(common && restored1 && restored2);
+    EXPECT_TRUE(restored1->Shape.getValue().IsPartner(common->Shape.getValue()));
+    EXPECT_TRUE(restored2->Shape.getValue().IsPartner(common->Shape.getValue()));
+    EXPECT_EQ(getVolume(restored2->Shape.getValue()), 3);
+    EXPECT_EQ(restored2->Shape.getShape().getElementMapSize(), mapSize);
+
+    std::filesystem::remove(fileName);
+}
+
 TEST_F(PropertyTopoShapeTest, testRestore)
 {
     // Test case for https://github.com/FreeCAD/FreeCAD/pull/16576
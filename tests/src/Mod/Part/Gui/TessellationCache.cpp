@@ -0,0 +1,248 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <BRepBuilderAPI_Copy.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <Standard_Version.hxx>
+#include <TopLoc_Location.hxx>
+#include <gp_Trsf.hxx>
+#include <gp_Vec.hxx>
+
+#include <Mod/Part/Gui/TessellationCache.h>
+#include <src/App/InitApplication.h>
+#include <src/TempDirectory.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+namespace fs = std::filesystem;
+using PartGui::CoinGeometry;
+using PartGui::TessellationCache;
+
+namespace
+{
+constexpr std::size_t MB = 1024 * 1024;
+constexpr std::size_t pointCount = 1000;
+
+CoinGeometry makeGeometry(float offset)
+{
+    CoinGeometry geometry;
+    for (std::size_t i = 0; i < pointCount; ++i) {
+        geometry.points.emplace_back(offset + static_cast<float>(i), 1.0F, 2.0F);
+        geometry.normals.emplace_back(0.0F, 0.0F, 1.0F);
+    }
+    geometry.faceIndices = {0, 1, 2, -1};
+    geometry.partIndices = {1};
+    geometry.lineIndices = {0, 1, -1};
+    geometry.pointStart = static_cast<int>(pointCount);
+    return geometry;
+}
+
+// an approximation of the memory used by an entry, without the small index arrays
+constexpr std::size_t entrySize = 2 * pointCount * sizeof(SbVec3f);
+
+std::vector<fs::path> cacheFiles(const fs::path& directory)
+{
+    std::vector<fs::path> files;
+    for (const auto& entry : fs::directory_iterator(directory)) {
+        if (entry.path().extension() == ".bin") {
+            files.push_back(entry.path());
+        }
+    }
+    return files;
+}
+
+std::uintmax_t directorySize(const fs::path& directory)
+{
+    std::uintmax_t size = 0;
+    for (const auto& path : cacheFiles(directory)) {
+        size += fs::file_size(path);
+    }
+    return size;
+}
+}  // namespace
+
+class TessellationCacheTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    // writes one entry to the directory and returns the path of its file
+    fs::path writeEntry()
+    {
+        TessellationCache cache(0, MB, directory.string());
+        cache.insert("entry", makeGeometry(0.0F));
+        auto files = cacheFiles(directory.path());
+        return files.size() == 1 ? files.front() : fs::path();
+    }
+
+    bool findEntry()
+    {
+        TessellationCache cache(0, MB, directory.string());
+        CoinGeometry geometry;
+        return cache.find("entry", geometry);
+    }
+
+    tests::TempDirectory directory {"TessellationCache"};
+};
+
+TEST_F(TessellationCacheTest, keyIsStable)
+{
+#if OCC_VERSION_HEX < 0x070600
+    GTEST_SKIP() << "shapes are only cached with OCC 7.6 or newer";
+#else
+    TopoDS_Shape box = BRepPrimAPI_MakeBox(1.0, 2.0, 3.0).Shape();
+    std::string key = TessellationCache::makeKey(box, 0.5, 28.5, false);
+    ASSERT_FALSE(key.empty());
+
+    // the key only depends on the data of the shape, so it's the same for the
+    // same shape built again, copied or read in another session
+    TopoDS_Shape rebuilt = BRepPrimAPI_MakeBox(1.0, 2.0, 3.0).Shape();
+    EXPECT_EQ(TessellationCache::makeKey(rebuilt, 0.5, 28.5, false), key);
+    TopoDS_Shape copy = BRepBuilderAPI_Copy(box).Shape();
+    EXPECT_EQ(TessellationCache::makeKey(copy, 0.5, 28.5, false), key);
+
+    // the placement is applied to the tessellation by Coin
+    gp_Trsf move;
+    move.SetTranslation(gp_Vec(10.0, 0.0, 0.0));
+    EXPECT_EQ(TessellationCache::makeKey(box.Moved(TopLoc_Location(move)), 0.5, 28.5, false), key);
+
+    TopoDS_Shape other = BRepPrimAPI_MakeBox(1.0, 2.0, 4.0).Shape();
+    EXPECT_NE(TessellationCache::makeKey(other, 0.5, 28.5, false), key);
+    EXPECT_NE(TessellationCache::makeKey(box, 0.25, 28.5, false), key);
+    EXPECT_NE(TessellationCache::makeKey(box, 0.5, 20.0, false), key);
+    EXPECT_NE(TessellationCache::makeKey(box, 0.5, 28.5, true), key);
+#endif
+}
+
+TEST_F(TessellationCacheTest, nullShapeHasNoKey)
+{
+    EXPECT_TRUE(TessellationCache::makeKey(TopoDS_Shape(), 0.5, 28.5, false).empty());
+}
+
+TEST_F(TessellationCacheTest, defaultMemoryLimit)
+{
+    EXPECT_EQ(TessellationCache::instance().getMaxMemSize(), 256 * MB);
+}
+
+TEST_F(TessellationCacheTest, leastRecentlyUsedEntryIsEvicted)
+{
+    // room for three entries
+    TessellationCache cache(3 * entrySize + pointCount, 0, {});
+    cache.insert("a", makeGeometry(1.0F));
+    cache.insert("b", makeGeometry(2.0F));
+    cache.insert("c", makeGeometry(3.0F));
+
+    CoinGeometry geometry;
+    ASSERT_TRUE(cache.find("a", geometry));
+    EXPECT_EQ(geometry.points.front()[0], 1.0F);
+
+    // "b" is the least recently used entry now
+    cache.insert("d", makeGeometry(4.0F));
+    EXPECT_FALSE(cache.find("b", geometry));
+    EXPECT_TRUE(cache.find("a", geometry));
+    EXPECT_TRUE(cache.find("c", geometry));
+    EXPECT_TRUE(cache.find("d", geometry));
+}
+
+TEST_F(TessellationCacheTest, entryLargerThanLimitIsNotKept)
+{
+    TessellationCache cache(entrySize / 2, 0, {});
+    cache.insert("a", makeGeometry(1.0F));
+    CoinGeometry geometry;
+    EXPECT_FALSE(cache.find("a", geometry));
+}
+
+TEST_F(TessellationCacheTest, disabledCacheKeepsNothing)
+{
+    TessellationCache cache(0, 0, directory.string());
+    EXPECT_FALSE(cache.isEnabled());
+    cache.insert("a", makeGeometry(1.0F));
+    CoinGeometry geometry;
+    EXPECT_FALSE(cache.find("a", geometry));
+    EXPECT_TRUE(cacheFiles(directory.path()).empty());
+}
+
+TEST_F(TessellationCacheTest, diskRoundTrip)
+{
+    CoinGeometry original = makeGeometry(5.0F);
+    {
+        TessellationCache cache(0, MB, directory.string());
+        cache.insert("entry", original);
+    }
+
+    // a cache of the next session finds the entry on disk
+    TessellationCache cache(0, MB, directory.string());
+    CoinGeometry geometry;
+    ASSERT_TRUE(cache.find("entry", geometry));
+    EXPECT_TRUE(geometry.points == original.points);
+    EXPECT_TRUE(geometry.normals == original.normals);
+    EXPECT_EQ(geometry.faceIndices, original.faceIndices);
+    EXPECT_EQ(geometry.partIndices, original.partIndices);
+    EXPECT_EQ(geometry.lineIndices, original.lineIndices);
+    EXPECT_EQ(geometry.pointStart, original.pointStart);
+}
+
+TEST_F(TessellationCacheTest, truncatedFileIsRejected)
+{
+    fs::path file = writeEntry();
+    ASSERT_FALSE(file.empty());
+    ASSERT_TRUE(findEntry());
+
+    fs::resize_file(file, fs::file_size(file) - 5);
+    EXPECT_FALSE(findEntry());
+
+    // only the header is left
+    fs::resize_file(file, 8);
+    EXPECT_FALSE(findEntry());
+}
+
+TEST_F(TessellationCacheTest, corruptHeaderIsRejected)
+{
+    fs::path file = writeEntry();
+    ASSERT_FALSE(file.empty());
+    {
+        std::fstream str(file, std::ios::in | std::ios::out | std::ios::binary);
+        str.write("XXXX", 4);
+    }
+    EXPECT_FALSE(findEntry());
+}
+
+TEST_F(TessellationCacheTest, corruptArraySizeIsRejected)
+{
+    fs::path file = writeEntry();
+    ASSERT_FALSE(file.empty());
+    {
+        // the size of the points follows the magic number, version and point start
+        std::fstream str(file, std::ios::in | std::ios::out | std::ios::binary);
+        str.seekp(12);
+        std::uint64_t size = 0x7fffffffffffULL;
+        str.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    }
+    EXPECT_FALSE(findEntry());
+}
+
+TEST_F(TessellationCacheTest, directoryIsTrimmedWhileWriting)
+{
+    // room for about four files
+    const std::size_t maxDiskSize = 4 * entrySize;
+    TessellationCache cache(0, maxDiskSize, directory.string());
+    for (int i = 0; i < 20; ++i) {
+        cache.insert("entry" + std::to_string(i), makeGeometry(static_cast<float>(i)));
+    }
+
+    // trimmed whenever a quarter of the limit has been written
+    EXPECT_LE(directorySize(directory.path()), maxDiskSize + maxDiskSize / 4 + entrySize);
+    EXPECT_LT(cacheFiles(directory.path()).size(), 20U);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
@@ -0,0 +1,97 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include <BRepPrimAPI_MakeBox.hxx>
+
+#include <Mod/Part/Gui/TessellationScheduler.h>
+#include <src/App/InitApplication.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+using PartGui::CoinGeometry;
+using PartGui::TessellationScheduler;
+
+constexpr int finest = TessellationScheduler::FinestLevel;
+constexpr int coarsest = TessellationScheduler::CoarsestLevel;
+
+TEST(TessellationScheduler, levelForScreenSize)
+{
+    EXPECT_EQ(TessellationScheduler::getLevelForScreenSize(1000.0F), finest);
+    EXPECT_EQ(TessellationScheduler::getLevelForScreenSize(256.0F), finest);
+    EXPECT_EQ(TessellationScheduler::getLevelForScreenSize(100.0F), finest + 1);
+    EXPECT_EQ(TessellationScheduler::getLevelForScreenSize(10.0F), coarsest);
+}
+
+TEST(TessellationScheduler, finestLevelKeepsParameters)
+{
+    double deviation = 0.5;
+    double angularDeflection = 28.5;
+    TessellationScheduler::getLevelParameters(finest, deviation, angularDeflection);
+    EXPECT_DOUBLE_EQ(deviation, 0.5);
+    EXPECT_DOUBLE_EQ(angularDeflection, 28.5);
+}
+
+TEST(TessellationScheduler, coarserLevelsScaleParameters)
+{
+    double deviation = 0.5;
+    double angularDeflection = 28.5;
+    TessellationScheduler::getLevelParameters(coarsest, deviation, angularDeflection);
+    EXPECT_DOUBLE_EQ(deviation, 8.0);
+    // the angular deflection is limited to 90 degrees
+    EXPECT_DOUBLE_EQ(angularDeflection, 90.0);
+
+    // a coarser user defined deflection is kept
+    deviation = 0.5;
+    angularDeflection = 120.0;
+    TessellationScheduler::getLevelParameters(coarsest, deviation, angularDeflection);
+    EXPECT_DOUBLE_EQ(angularDeflection, 120.0);
+}
+
+class TessellationSchedulerTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+};
+
+TEST_F(TessellationSchedulerTest, waitForDoneWithoutRequests)
+{
+    // must return at once if nothing is queued
+    TessellationScheduler::instance().waitForDone();
+    TessellationScheduler::instance().waitForDone();
+    SUCCEED();
+}
+
+TEST_F(TessellationSchedulerTest, waitForDoneInstallsQueuedShapes)
+{
+    auto& scheduler = TessellationScheduler::instance();
+    std::vector<std::size_t> points(3);
+    int received = 0;
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        TopoDS_Shape box = BRepPrimAPI_MakeBox(1.0 + i, 2.0, 3.0).Shape();
+        scheduler.schedule(box, 0.5, 28.5, false, [&, i](const CoinGeometry* geometry) {
+            ++received;
+            points[i] = geometry ? geometry->points.size() : 0;
+        });
+    }
+    // nothing is installed before the event loop or a flush processes the queue
+    EXPECT_EQ(received, 0);
+
+    scheduler.waitForDone();
+
+    EXPECT_EQ(received, 3);
+    for (auto count : points) {
+        EXPECT_GT(count, 0U);
+    }
+
+    // the results are installed only once
+    scheduler.waitForDone();
+    EXPECT_EQ(received, 3);
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
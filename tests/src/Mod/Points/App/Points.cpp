@@ -240,4 +240,64 @@ TEST_F(PointsTest, TestPCDStructured)
     EXPECT_EQ(reader.getWidth(), 4);
     EXPECT_EQ(reader.getHeight(), 2);
 }
+
+TEST_F(PointsTest, TestASCIIWithStep)
+{
+    std::string name = getFileName() + ".asc";
+    Points::AscWriter writer(getKernel());
+    writer.write(name);
+
+    Points::AscReader reader;
+    reader.setStep(3);
+    reader.read(name);
+
+    ASSERT_EQ(reader.getPoints().size(), 3);
+    EXPECT_EQ(reader.getPoints().getPoint(1), getKernel().getPoint(3));
+    EXPECT_EQ(reader.getWidth(), 3);
+}
+
+TEST_F(PointsTest, TestPLYWithStep)
+{
+    std::string name = getFileName();
+    Points::PlyWriter writer(getKernel());
+    writer.setIntensities(getIntensity());
+    writer.setColors(getColors());
+    writer.setNormals(getNormals());
+    writer.write(name);
+
+    Points::PlyReader reader;
+    reader.setStep(2);
+    reader.read(name);
+
+    ASSERT_EQ(reader.getPoints().size(), 4);
+    EXPECT_EQ(reader.getPoints().getPoint(1), getKernel().getPoint(2));
+    EXPECT_EQ(reader.getIntensities().size(), 4);
+    EXPECT_EQ(reader.getColors().size(), 4);
+    EXPECT_EQ(reader.getNormals().size(), 4);
+    EXPECT_EQ(reader.getWidth(), 4);
+    EXPECT_EQ(reader.getHeight(), 1);
+}
+
+TEST_F(PointsTest, TestPCDWithBoundBox)
+{
+    std::string name = getFileName();
+    Points::PcdWriter writer(getKernel());
+    writer.setIntensities(getIntensity());
+    writer.setWidth(4);
+    writer.setHeight(2);
+    writer.write(name);
+
+    Points::PcdReader reader;
+    reader.setBoundBox(Base::BoundBox3d(-0.5, -0.5, -0.5, 0.5, 1.5, 1.5));
+    reader.read(name);
+
+    ASSERT_EQ(reader.getPoints().size(), 4);
+    for (const auto& pnt : reader.getPoints()) {
+        EXPECT_DOUBLE_EQ(pnt.x, 0.0);
+    }
+    EXPECT_EQ(reader.getIntensities().size(), 4);
+    EXPECT_FALSE(reader.isStructured());
+    EXPECT_EQ(reader.getWidth(), 4);
+    EXPECT_EQ(reader.getHeight(), 1);
+}
 // NOLINTEND(cppcoreguidelines-*,readability-*)
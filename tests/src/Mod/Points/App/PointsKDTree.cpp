@@ -0,0 +1,177 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+
+#include <Mod/Points/App/Points.h>
+#include <Mod/Points/App/PointsKDTree.h>
+
+// NOLINTBEGIN(cppcoreguidelines-*,readability-*)
+
+class PointsKDTreeTest: public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // a very non-uniform distribution
+        std::mt19937 gen(42);
+        std::uniform_real_distribution<double> dist(0.0, 1.0);
+        for (int i = 0; i < 20000; i++) {
+            double x = dist(gen);
+            points.emplace_back(x * x * x, dist(gen), 0.1 * dist(gen));
+        }
+    }
+
+    std::vector<std::size_t> bruteForceNearest(const Base::Vector3d& pnt, std::size_t k) const
+    {
+        std::vector<std::size_t> indices(points.size());
+        for (std::size_t i = 0; i < indices.size(); i++) {
+            indices[i] = i;
+        }
+        std::sort(indices.begin(), indices.end(), [&](std::size_t lhs, std::size_t rhs) {
+            return Base::DistanceP2(pnt, points[lhs]) < Base::DistanceP2(pnt, points[rhs]);
+        });
+        indices.resize(k);
+        return indices;
+    }
+
+    std::vector<Base::Vector3d> points;
+};
+
+TEST_F(PointsKDTreeTest, TestEmpty)
+{
+    Points::PointsKDTree tree(std::vector<Base::Vector3d> {});
+    std::vector<std::size_t> indices;
+    tree.FindNearest(Base::Vector3d(), 5, indices);
+    EXPECT_TRUE(indices.empty());
+    tree.FindInRange(Base::Vector3d(), 1.0, indices);
+    EXPECT_TRUE(indices.empty());
+}
+
+TEST_F(PointsKDTreeTest, TestFindNearest)
+{
+    Points::PointsKDTree tree(points);
+    ASSERT_EQ(tree.Size(), points.size());
+
+    std::vector<Base::Vector3d> queries {
+        Base::Vector3d(0.0, 0.0, 0.0),
+        Base::Vector3d(0.5, 0.5, 0.05),
+        Base::Vector3d(0.9, 0.1, 0.2),
+        points[100]
+    };
+
+    std::vector<std::vector<std::size_t>> result = tree.FindNearest(queries, 7);
+    ASSERT_EQ(result.size(), queries.size());
+    for (std::size_t i = 0; i < queries.size(); i++) {
+        EXPECT_EQ(result[i], bruteForceNearest(queries[i], 7));
+    }
+    EXPECT_EQ(result[3][0], 100);
+}
+
+TEST_F(PointsKDTreeTest, TestFindInRange)
+{
+    Points::PointsKDTree tree(points);
+
+    Base::Vector3d pnt(0.1, 0.5, 0.05);
+    double radius = 0.05;
+    std::vector<std::size_t> indices;
+    tree.FindInRange(pnt, radius, indices);
+    std::sort(indices.begin(), indices.end());
+
+    std::vector<std::size_t> expected;
+    for (std::size_t i = 0; i < points.size(); i++) {
+        if (Base::Distance(pnt, points[i]) <= radius) {
+            expected.push_back(i);
+        }
+    }
+    EXPECT_FALSE(expected.empty());
+    EXPECT_EQ(indices, expected);
+}
+
+TEST_F(PointsKDTreeTest, TestPointKernel)
+{
+    Points::PointKernel kernel;
+    kernel.push_back(Base::Vector3d(0, 0, 0));
+    kernel.push_back(Base::Vector3d(1, 0, 0));
+    kernel.push_back(Base::Vector3d(5, 0, 0));
+
+    Points::PointsKDTree tree(kernel);
+    std::vector<std::size_t> indices;
+    tree.FindNearest(Base::Vector3d(4, 0, 0), 2, indices);
+    EXPECT_EQ(indices, (std::vector<std::size_t> {2, 1}));
+}
+
+TEST_F(PointsKDTreeTest, TestNormalEstimation)
+{
+    // points on the plane z = 0
+    std::vector<Base::Vector3d> plane;
+    for (int i = 0; i < 50; i++) {
+        for (int j = 0; j < 50; j++) {
+            plane.emplace_back(0.1 * i, 0.2 * j, 0.0);
+        }
+    }
+
+    Points::PointsKDTree tree(plane);
+    Points::NormalEstimation estimation(tree);
+    estimation.setKSearch(8);
+
+    std::vector<Base::Vector3d> normals;
+    std::vector<double> curvatures;
+    estimation.perform(normals, curvatures);
+    ASSERT_EQ(normals.size(), plane.size());
+    ASSERT_EQ(curvatures.size(), plane.size());
+    for (std::size_t i = 0; i < normals.size(); i++) {
+        EXPECT_NEAR(std::abs(normals[i].z), 1.0, 1e-9);
+        EXPECT_NEAR(curvatures[i], 0.0, 1e-9);
+    }
+}
+
+TEST_F(PointsKDTreeTest, TestParallelBuild)
+{
+    // enough points to build several sub-trees in parallel
+    std::vector<Base::Vector3d> many;
+    for (int i = 0; i < 10; i++) {
+        for (const auto& pnt : points) {
+            many.push_back(pnt + Base::Vector3d(i, 0, 0));
+        }
+    }
+    points.swap(many);
+
+    Points::PointsKDTree tree(points);
+    std::vector<Base::Vector3d> queries {
+        Base::Vector3d(0.0, 0.0, 0.0),
+        Base::Vector3d(4.5, 0.5, 0.05),
+        Base::Vector3d(9.9, 0.1, 0.2)
+    };
+    std::vector<std::size_t> indices;
+    for (const auto& pnt : queries) {
+        tree.FindNearest(pnt, 5, indices);
+        EXPECT_EQ(indices, bruteForceNearest(pnt, 5));
+    }
+}
+
+TEST_F(PointsKDTreeTest, TestNormalEstimationInRange)
+{
+    // points on the plane x = 0
+    std::vector<Base::Vector3d> plane;
+    for (int i = 0; i < 30; i++) {
+        for (int j = 0; j < 30; j++) {
+            plane.emplace_back(0.0, 0.1 * i, 0.1 * j);
+        }
+    }
+
+    Points::PointsKDTree tree(plane);
+    Points::NormalEstimation estimation(tree);
+    estimation.setSearchRadius(0.25);
+
+    std::vector<Base::Vector3d> normals;
+    estimation.perform(normals);
+    ASSERT_EQ(normals.size(), plane.size());
+    for (const auto& normal : normals) {
+        EXPECT_NEAR(std::abs(normal.x), 1.0, 1e-9);
+    }
+}
+
+// NOLINTEND(cppcoreguidelines-*,readability-*)
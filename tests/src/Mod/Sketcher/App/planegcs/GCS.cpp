@@ -50,3 +50,138 @@ TEST_F(GCSTest, clearConstraints)  // NOLINT
     // Assert
     EXPECT_EQ(0, System()->getNumberOfConstraints());
 }
+
+TEST_F(GCSTest, solveWithSparseJacobian)  // NOLINT
+{
+    // Arrange
+    // a chain of parameters, each one unit apart from the previous one
+    const size_t numParams {100};
+    double origin = 0.0;
+    double unit = 1.0;
+    std::vector<double> values(numParams);
+    GCS::VEC_pD params;
+    double* previous = &origin;
+    for (auto& value : values) {
+        params.push_back(&value);
+        System()->addConstraintDifference(previous, &value, &unit);
+        previous = &value;
+    }
+    System()->autoSparseThreshold = 0;
+
+    for (auto algorithm : {GCS::LevenbergMarquardt, GCS::DogLeg}) {
+        std::fill(values.begin(), values.end(), 0.5);
+
+        // Act
+        int result = System()->solve(params, true, algorithm);
+        System()->applySolution();
+
+        // Assert
+        EXPECT_EQ(result, GCS::Success);
+        for (size_t i = 0; i < numParams; ++i) {
+            EXPECT_NEAR(values[i], double(i + 1), 1e-9);
+        }
+    }
+}
+
+TEST_F(GCSTest, solveIndependentComponents)  // NOLINT
+{
+    // Arrange
+    // several chains of parameters, each one unit apart from the previous one in the chain
+    const size_t numChains {4};
+    const size_t numParams {40};
+    std::vector<double> origins(numChains);
+    std::vector<std::vector<double>> values(numChains, std::vector<double>(numParams, 0.5));
+    double unit = 1.0;
+    GCS::VEC_pD params;
+    for (size_t chain = 0; chain < numChains; ++chain) {
+        origins[chain] = 10.0 * chain;
+        double* previous = &origins[chain];
+        for (auto& value : values[chain]) {
+            params.push_back(&value);
+            System()->addConstraintDifference(previous, &value, &unit);
+            previous = &value;
+        }
+    }
+
+    // Act
+    int result = System()->solve(params);
+    System()->applySolution();
+
+    // Assert
+    EXPECT_EQ(result, GCS::Success);
+    for (size_t chain = 0; chain < numChains; ++chain) {
+        for (size_t i = 0; i < numParams; ++i) {
+            EXPECT_NEAR(values[chain][i], origins[chain] + double(i + 1), 1e-9);
+        }
+    }
+}
+
+TEST_F(GCSTest, diagnoseIndependentComponents)  // NOLINT
+{
+    // Arrange
+    // two independent chains of three parameters, the first one constrained twice at its end,
+    // and a parameter that is not constrained at all
+    double origin = 0.0;
+    double unit = 1.0;
+    std::vector<double> first {1.0, 2.0, 3.0};
+    std::vector<double> second {1.0, 2.0, 3.0};
+    double free = 0.0;
+    GCS::VEC_pD params {&first[0], &first[1], &first[2], &second[0], &second[1], &second[2], &free};
+    System()->addConstraintDifference(&origin, &first[0], &unit, 1);
+    System()->addConstraintDifference(&first[0], &first[1], &unit, 2);
+    System()->addConstraintDifference(&first[1], &first[2], &unit, 3);
+    System()->addConstraintDifference(&first[1], &first[2], &unit, 4);
+    System()->addConstraintDifference(&origin, &second[0], &unit, 5);
+    System()->addConstraintDifference(&second[0], &second[1], &unit, 6);
+    System()->addConstraintDifference(&second[1], &second[2], &unit, 7);
+    System()->declareUnknowns(params);
+
+    // Act
+    int dofs = System()->diagnose();
+
+    // Assert
+    GCS::VEC_I conflicting, redundant;
+    System()->getConflicting(conflicting);
+    System()->getRedundant(redundant);
+    GCS::VEC_pD dependent;
+    System()->getDependentParams(dependent);
+    EXPECT_EQ(dofs, 1);
+    EXPECT_TRUE(conflicting.empty());
+    EXPECT_EQ(redundant, GCS::VEC_I {4});
+    EXPECT_EQ(dependent, GCS::VEC_pD {&free});
+}
+
+TEST_F(GCSTest, solveIncrementalFollowsTemporaryConstraints)  // NOLINT
+{
+    // Arrange
+    // a rigid pair of parameters dragged by a temporary constraint, and an independent parameter
+    double origin = 0.0;
+    double unit = 1.0;
+    double two = 2.0;
+    double target = 0.5;
+    double first = 0.0;
+    double second = 1.0;
+    double other = 0.0;
+    GCS::VEC_pD params {&first, &second, &other};
+    System()->addConstraintDifference(&first, &second, &unit, 1);
+    System()->addConstraintDifference(&origin, &other, &two, 2);
+    System()->addConstraintEqual(&first, &target, GCS::DefaultTemporaryConstraint);
+    System()->declareUnknowns(params);
+    System()->initSolution();
+
+    // Act
+    std::vector<int> results;
+    for (double step : {0.5, 1.0, 1.5, 2.0}) {
+        target = step;
+        results.push_back(System()->solveIncremental());
+        System()->applySolution();
+    }
+
+    // Assert
+    for (int result : results) {
+        EXPECT_EQ(result, GCS::Success);
+    }
+    EXPECT_NEAR(first, 2.0, 1e-9);
+    EXPECT_NEAR(second, 3.0, 1e-9);
+    EXPECT_NEAR(other, 2.0, 1e-9);
+}
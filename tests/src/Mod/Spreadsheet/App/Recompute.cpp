@@ -0,0 +1,117 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <gtest/gtest.h>
+#include "src/App/InitApplication.h"
+
+#include <string>
+
+#include <App/Application.h>
+#include <App/Document.h>
+#include <App/PropertyStandard.h>
+#include <Mod/Spreadsheet/App/Cell.h>
+#include <Mod/Spreadsheet/App/Sheet.h>
+
+class SheetRecomputeTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+
+    void SetUp() override
+    {
+        _docName = App::GetApplication().getUniqueDocumentName("test");
+        _doc = App::GetApplication().newDocument(_docName.c_str(), "testUser");
+        _sheet = freecad_cast<Spreadsheet::Sheet*>(_doc->addObject("Spreadsheet::Sheet", "Sheet"));
+    }
+
+    void TearDown() override
+    {
+        App::GetApplication().closeDocument(_docName.c_str());
+    }
+
+    Spreadsheet::Sheet* sheet()
+    {
+        return _sheet;
+    }
+
+    App::Document* doc()
+    {
+        return _doc;
+    }
+
+    long integerValue(const char* address)
+    {
+        auto prop = freecad_cast<App::PropertyInteger*>(_sheet->getPropertyByName(address));
+        EXPECT_NE(prop, nullptr) << address;
+        return prop ? prop->getValue() : 0;
+    }
+
+private:
+    std::string _docName;
+    App::Document* _doc {};
+    Spreadsheet::Sheet* _sheet {};
+};
+
+TEST_F(SheetRecomputeTest, dependentCells)  // NOLINT
+{
+    sheet()->setCell("A1", "1");
+    sheet()->setCell("A2", "=A1 + 1");
+    sheet()->setCell("B1", "=$A$1 * 2");
+    sheet()->setCell("B2", "=A2");
+
+    const auto& deps = sheet()->getCells()->getDependentCells(App::CellAddress("A1"));
+    EXPECT_EQ(deps.size(), 2U);
+    EXPECT_TRUE(deps.contains(App::CellAddress("A2")));
+    EXPECT_TRUE(deps.contains(App::CellAddress("B1")));
+
+    sheet()->setCell("B2", "");
+    EXPECT_TRUE(sheet()->getCells()->getDependentCells(App::CellAddress("A2")).empty());
+}
+
+TEST_F(SheetRecomputeTest, recomputeDependents)  // NOLINT
+{
+    sheet()->setCell("A1", "2");
+    sheet()->setCell("A2", "=A1 * 3");
+    sheet()->setCell("A3", "=A2 + A1");
+    sheet()->setCell("A4", "=A1 * 1 mm");
+    doc()->recompute();
+    EXPECT_EQ(integerValue("A3"), 8);
+
+    sheet()->setCell("A1", "5");
+    doc()->recompute();
+    EXPECT_EQ(integerValue("A3"), 20);
+    auto quantity = freecad_cast<App::PropertyQuantity*>(sheet()->getPropertyByName("A4"));
+    ASSERT_NE(quantity, nullptr);
+    EXPECT_DOUBLE_EQ(quantity->getValue(), 5.0);
+    EXPECT_EQ(quantity->getUnit(), Base::Unit::Length);
+}
+
+TEST_F(SheetRecomputeTest, recomputeManyIndependentCells)  // NOLINT
+{
+    constexpr int rows = 1000;
+    sheet()->setCell("A1", "1");
+    for (int row = 1; row <= rows; ++row) {
+        std::string address = "B" + std::to_string(row);
+        sheet()->setCell(address.c_str(), ("=A1 * " + std::to_string(row)).c_str());
+    }
+    doc()->recompute();
+
+    sheet()->setCell("A1", "3");
+    doc()->recompute();
+    for (int row = 1; row <= rows; ++row) {
+        std::string address = "B" + std::to_string(row);
+        EXPECT_EQ(integerValue(address.c_str()), 3L * row);
+    }
+}
+
+TEST_F(SheetRecomputeTest, cyclicDependency)  // NOLINT
+{
+    sheet()->setCell("A1", "=A2");
+    sheet()->setCell("A2", "=A1");
+    doc()->recompute();
+
+    EXPECT_TRUE(sheet()->getCell(App::CellAddress("A1"))->hasException());
+    EXPECT_TRUE(sheet()->getCell(App::CellAddress("A2"))->hasException());
+}
@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+
+#include <BRepGProp.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <BRepPrimAPI_MakeCylinder.hxx>
+#include <BRep_Builder.hxx>
+#include <GProp_GProps.hxx>
+#include <TopExp.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+#include <TopoDS_Compound.hxx>
+#include <gp_Ax2.hxx>
+
+#include "Mod/TechDraw/App/GeometryObject.h"
+#include "Mod/TechDraw/App/HLRCache.h"
+#include "src/App/InitApplication.h"
+
+namespace
+{
+class TestGeometryObject: public TechDraw::GeometryObject
+{
+public:
+    using GeometryObject::GeometryObject;
+    using GeometryObject::groupForHLR;
+};
+
+//! three separate boxes, one of them partly hidden behind a cylinder
+TopoDS_Shape makeSolids()
+{
+    BRep_Builder builder;
+    TopoDS_Compound compound;
+    builder.MakeCompound(compound);
+    for (double x : {0.0, 50.0, 100.0}) {
+        builder.Add(compound, BRepPrimAPI_MakeBox(gp_Pnt(x, 0.0, 0.0), 10.0, 10.0, 10.0).Shape());
+    }
+    gp_Ax2 axis(gp_Pnt(5.0, -20.0, 5.0), gp_Dir(0.0, 0.0, 1.0));
+    builder.Add(compound, BRepPrimAPI_MakeCylinder(axis, 4.0, 10.0).Shape());
+    return compound;
+}
+
+gp_Ax2 viewAxis()
+{
+    return {gp_Pnt(0.0, 0.0, 0.0), gp_Dir(0.0, -1.0, 0.2)};
+}
+
+int edgeCount(const TopoDS_Shape& shape)
+{
+    if (shape.IsNull()) {
+        return 0;
+    }
+    TopTools_IndexedMapOfShape edges;
+    TopExp::MapShapes(shape, TopAbs_EDGE, edges);
+    return edges.Extent();
+}
+
+double length(const TopoDS_Shape& shape)
+{
+    if (shape.IsNull()) {
+        return 0.0;
+    }
+    GProp_GProps props;
+    BRepGProp::LinearProperties(shape, props);
+    return props.Mass();
+}
+
+void expectSameEdges(const TopoDS_Shape& parallel, const TopoDS_Shape& serial)
+{
+    EXPECT_EQ(edgeCount(parallel), edgeCount(serial));
+    EXPECT_NEAR(length(parallel), length(serial), 1e-6);
+}
+}  // namespace
+
+class GeometryObjectTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+};
+
+TEST_F(GeometryObjectTest, parallelHLRMatchesSerialHLR)
+{
+    TopoDS_Shape shape = makeSolids();
+
+    TestGeometryObject serial("serial", nullptr);
+    TechDraw::HLRCache::instance().clear();
+    serial.projectShape(shape, viewAxis());
+
+    TestGeometryObject parallel("parallel", nullptr);
+    parallel.useParallelHLR(true);
+    ASSERT_GT(parallel.groupForHLR(shape, viewAxis()).size(), 1);
+    // without the cache the grouped projection would reuse the serial result
+    TechDraw::HLRCache::instance().clear();
+    parallel.projectShape(shape, viewAxis());
+
+    expectSameEdges(parallel.getVisHard(), serial.getVisHard());
+    expectSameEdges(parallel.getVisOutline(), serial.getVisOutline());
+    expectSameEdges(parallel.getVisSmooth(), serial.getVisSmooth());
+    expectSameEdges(parallel.getVisSeam(), serial.getVisSeam());
+    expectSameEdges(parallel.getHidHard(), serial.getHidHard());
+    expectSameEdges(parallel.getHidOutline(), serial.getHidOutline());
+    expectSameEdges(parallel.getHidSmooth(), serial.getHidSmooth());
+    expectSameEdges(parallel.getHidSeam(), serial.getHidSeam());
+    EXPECT_GT(length(serial.getHidHard()), 0.0);
+}
+
+TEST_F(GeometryObjectTest, perspectiveViewIsNotGrouped)
+{
+    TestGeometryObject geometry("perspective", nullptr);
+    geometry.isPerspective(true);
+    EXPECT_TRUE(geometry.groupForHLR(makeSolids(), viewAxis()).empty());
+}
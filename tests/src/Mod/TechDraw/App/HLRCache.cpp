@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+
+#include <BRepGProp.hxx>
+#include <BRepPrimAPI_MakeBox.hxx>
+#include <GProp_GProps.hxx>
+#include <gp_Ax2.hxx>
+
+#include "Mod/TechDraw/App/GeometryObject.h"
+#include "Mod/TechDraw/App/HLRCache.h"
+#include "src/App/InitApplication.h"
+
+namespace
+{
+TopoDS_Shape makeBox(double x, double size = 10.0)
+{
+    return BRepPrimAPI_MakeBox(gp_Pnt(x, 0.0, 0.0), size, size, size).Shape();
+}
+
+double length(const TopoDS_Shape& shape)
+{
+    if (shape.IsNull()) {
+        return 0.0;
+    }
+    GProp_GProps props;
+    BRepGProp::LinearProperties(shape, props);
+    return props.Mass();
+}
+
+gp_Ax2 isoAxis()
+{
+    return {gp_Pnt(0.0, 0.0, 0.0), gp_Dir(1.0, -1.0, 1.0)};
+}
+}  // namespace
+
+class HLRCacheTest: public ::testing::Test
+{
+protected:
+    static void SetUpTestSuite()
+    {
+        tests::initApplication();
+    }
+};
+
+TEST_F(HLRCacheTest, findReturnsInsertedResult)
+{
+    TechDraw::HLRCache cache(2);
+    TopoDS_Shape box = makeBox(0.0);
+    cache.insert("a", box);
+
+    TopoDS_Shape result;
+    EXPECT_TRUE(cache.find("a", result));
+    EXPECT_TRUE(result.IsSame(box));
+    EXPECT_FALSE(cache.find("b", result));
+}
+
+TEST_F(HLRCacheTest, insertEvictsLeastRecentlyUsed)
+{
+    TechDraw::HLRCache cache(2);
+    cache.insert("a", makeBox(0.0));
+    cache.insert("b", makeBox(20.0));
+
+    // looking up "a" makes "b" the least recently used result
+    TopoDS_Shape result;
+    ASSERT_TRUE(cache.find("a", result));
+    cache.insert("c", makeBox(40.0));
+
+    EXPECT_TRUE(cache.find("a", result));
+    EXPECT_FALSE(cache.find("b", result));
+    EXPECT_TRUE(cache.find("c", result));
+}
+
+TEST_F(HLRCacheTest, zeroSizeKeepsNothing)
+{
+    TechDraw::HLRCache cache(0);
+    cache.insert("a", makeBox(0.0));
+
+    TopoDS_Shape result;
+    EXPECT_FALSE(cache.find("a", result));
+}
+
+TEST_F(HLRCacheTest, makeKeyDependsOnShapeAndProjection)
+{
+    std::string key = TechDraw::HLRCache::makeKey(makeBox(0.0), isoAxis(), 0, false, 100.0);
+    if (key.empty()) {
+        GTEST_SKIP() << "HLR results are not cached with this OCCT version";
+    }
+
+    EXPECT_EQ(TechDraw::HLRCache::makeKey(makeBox(0.0), isoAxis(), 0, false, 100.0), key);
+    EXPECT_NE(TechDraw::HLRCache::makeKey(makeBox(5.0), isoAxis(), 0, false, 100.0), key);
+    EXPECT_NE(TechDraw::HLRCache::makeKey(makeBox(0.0), gp_Ax2(), 0, false, 100.0), key);
+    EXPECT_NE(TechDraw::HLRCache::makeKey(makeBox(0.0), isoAxis(), 2, false, 100.0), key);
+    EXPECT_NE(TechDraw::HLRCache::makeKey(makeBox(0.0), isoAxis(), 0, true, 100.0), key);
+}
+
+TEST_F(HLRCacheTest, unpackRejectsForeignShapes)
+{
+    TechDraw::GeometryObject geometry("unpack", nullptr);
+    EXPECT_FALSE(geometry.unpackHLR(makeBox(0.0)));
+}
+
+TEST_F(HLRCacheTest, projectShapeUsesRestoredResult)
+{
+    TopoDS_Shape box = makeBox(0.0);
+    std::string key = TechDraw::HLRCache::makeKey(box, isoAxis(), 0, false, 100.0);
+    if (key.empty()) {
+        GTEST_SKIP() << "HLR results are not cached with this OCCT version";
+    }
+
+    // seed the cache like DrawViewPart::onDocumentRestored does, with the result of a
+    // different shape, so a cache hit can be told from a new HLR run
+    TechDraw::GeometryObject source("source", nullptr);
+    source.projectShape(makeBox(0.0, 20.0), isoAxis());
+    TechDraw::HLRCache::instance().insert(key, source.packHLR());
+
+    TechDraw::GeometryObject restored("restored", nullptr);
+    restored.projectShape(box, isoAxis());
+
+    EXPECT_EQ(restored.getHLRKey(), key);
+    EXPECT_DOUBLE_EQ(length(restored.getVisHard()), length(source.getVisHard()));
+    EXPECT_DOUBLE_EQ(length(restored.getHidHard()), length(source.getHidHard()));
+    EXPECT_DOUBLE_EQ(length(restored.getVisOutline()), length(source.getVisOutline()));
+}